@@ -5,6 +5,7 @@
 #include <fstream>
 #include <cmath>
 #include <complex>
+#include <cstdlib>
 #include "../headers/ParallelCalculator.hpp"
 #include "../headers/SequentialCalculator.hpp"
 
@@ -18,6 +19,12 @@ int main(int argc, char** argv) {
     SequentialCalculator seqCalc;
     ParallelCalculator parCalc;
     parCalc.setNumThreads(1);
+    // the calculate_distributed mode under test, e.g. FRACTAL_MPI_GATHER=iter16 ./run_mpi_benchmarks.sh
+    if (const char* shared = std::getenv("FRACTAL_MPI_SHARED")) parCalc.setSharedMemory(std::string(shared) == "1");
+    if (const char* gather = std::getenv("FRACTAL_MPI_GATHER")) parCalc.setGatherFormat(gather);
+    if (const char* decomposition = std::getenv("FRACTAL_MPI_DECOMPOSITION")) parCalc.setDecomposition(decomposition);
+    std::string mode = parCalc.getSharedMemory() ? "shared"
+                                                 : parCalc.getGatherFormat() + "/" + parCalc.getDecomposition();
 
     std::vector<int> sizes = {256, 512, 1024, 2048, 4096};
     const std::complex<double> c = {-0.8, 0.156};
@@ -31,7 +38,7 @@ int main(int argc, char** argv) {
     infile.close();
     if (rank == 0 && !file_exists) {
         std::ofstream file("mpi_scaledsize.csv", std::ios::app);
-        file << "ImageSize,Schedule,Threads,Sequential,Parallel,Speedup,Efficiency\n";
+        file << "ImageSize,Schedule,Threads,Sequential,Parallel,Speedup,Efficiency,Mode\n";
         file.close();
     }
     for (int size : sizes) {
@@ -49,9 +56,9 @@ int main(int argc, char** argv) {
             double speedup = t_seq / t_par;
             double eff = (speedup / n_ranks) * 100.0;
             std::ofstream file("mpi_scaledsize.csv", std::ios::app);
-            file << size << ",static," << n_ranks << "," << t_seq << "," << t_par << "," << speedup << "," << eff << "\n";
+            file << size << ",static," << n_ranks << "," << t_seq << "," << t_par << "," << speedup << "," << eff << "," << mode << "\n";
             file.close();
-            std::cout << "Scaling Size: " << size << " | Ranks: " << n_ranks << " | Speedup: " << speedup << "\n";
+            std::cout << "Scaling Size: " << size << " | Ranks: " << n_ranks << " | Mode: " << mode << " | Speedup: " << speedup << "\n";
         }
     }
     MPI_Finalize();
@@ -1,4 +1,8 @@
 #!/bin/bash
+# The calculate_distributed mode comes from the environment (defaults: RGBA gather, row bands):
+#   FRACTAL_MPI_SHARED=1                       shared-memory frame per node
+#   FRACTAL_MPI_GATHER=iter16|palette8         compact iteration-count gather
+#   FRACTAL_MPI_DECOMPOSITION=rows|cart|auto   row bands or a 2D block grid
 
 cd "$(dirname "$0")"
 
@@ -6,6 +10,8 @@ echo "Compiling MPI tests..."
 
 mpic++ mpi_tests_fixed.cpp \
     ../src/ParallelCalculator.cpp \
+    ../src/TileScheduler.cpp \
+    ../src/CpuBudget.cpp \
     ../src/SequentialCalculator.cpp \
     ../src/JuliaSetCalculator.cpp \
     -I../headers \
@@ -15,6 +21,8 @@ mpic++ mpi_tests_fixed.cpp \
 
 mpic++ mpi_tests_scaling.cpp \
     ../src/ParallelCalculator.cpp \
+    ../src/TileScheduler.cpp \
+    ../src/CpuBudget.cpp \
     ../src/SequentialCalculator.cpp \
     ../src/JuliaSetCalculator.cpp \
     -I../headers \
@@ -22,14 +30,19 @@ mpic++ mpi_tests_scaling.cpp \
     -lsfml-graphics -lsfml-window -lsfml-system \
     -o mpi_tests_scaling
 
-echo "Running MPI benchmarks..."
+export FRACTAL_MPI_SHARED=${FRACTAL_MPI_SHARED:-0}
+export FRACTAL_MPI_GATHER=${FRACTAL_MPI_GATHER:-rgba}
+export FRACTAL_MPI_DECOMPOSITION=${FRACTAL_MPI_DECOMPOSITION:-rows}
+MODE="-x FRACTAL_MPI_SHARED -x FRACTAL_MPI_GATHER -x FRACTAL_MPI_DECOMPOSITION"
+
+echo "Running MPI benchmarks (shared=$FRACTAL_MPI_SHARED gather=$FRACTAL_MPI_GATHER decomposition=$FRACTAL_MPI_DECOMPOSITION)..."
 
 for np in 1 2 3 4 5 6; do
     echo "Running mpi_tests_fixed with $np processes..."
-    mpirun -np $np ./mpi_tests_fixed
+    mpirun -np $np $MODE ./mpi_tests_fixed
 
     echo "Running mpi_tests_scaling with $np processes..."
-    mpirun -np $np ./mpi_tests_scaling
+    mpirun -np $np $MODE ./mpi_tests_scaling
 
     echo "---"
 done
@@ -23,7 +23,12 @@ namespace fractal {
 
 static const char* FractalService_method_names[] = {
   "/fractal.FractalService/CalculateJulia",
+  "/fractal.FractalService/CalculateJuliaBatch",
+  "/fractal.FractalService/CalculateJuliaStream",
+  "/fractal.FractalService/RenderTrajectory",
+  "/fractal.FractalService/InteractiveSession",
   "/fractal.FractalService/Shutdown",
+  "/fractal.FractalService/GetServerStats",
 };
 
 std::unique_ptr< FractalService::Stub> FractalService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -34,7 +39,12 @@ std::unique_ptr< FractalService::Stub> FractalService::NewStub(const std::shared
 
 FractalService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_CalculateJulia_(FractalService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Shutdown_(FractalService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CalculateJuliaBatch_(FractalService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_CalculateJuliaStream_(FractalService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_RenderTrajectory_(FractalService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_InteractiveSession_(FractalService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_Shutdown_(FractalService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetServerStats_(FractalService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status FractalService::Stub::CalculateJulia(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::fractal::JuliaResponse* response) {
@@ -60,6 +70,70 @@ void FractalService::Stub::async::CalculateJulia(::grpc::ClientContext* context,
   return result;
 }
 
+::grpc::ClientReader< ::fractal::JuliaBatchResponse>* FractalService::Stub::CalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::fractal::JuliaBatchResponse>::Create(channel_.get(), rpcmethod_CalculateJuliaBatch_, context, request);
+}
+
+void FractalService::Stub::async::CalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest* request, ::grpc::ClientReadReactor< ::fractal::JuliaBatchResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::fractal::JuliaBatchResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_CalculateJuliaBatch_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>* FractalService::Stub::AsyncCalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fractal::JuliaBatchResponse>::Create(channel_.get(), cq, rpcmethod_CalculateJuliaBatch_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>* FractalService::Stub::PrepareAsyncCalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fractal::JuliaBatchResponse>::Create(channel_.get(), cq, rpcmethod_CalculateJuliaBatch_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::fractal::FrameChunk>* FractalService::Stub::CalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::fractal::FrameChunk>::Create(channel_.get(), rpcmethod_CalculateJuliaStream_, context, request);
+}
+
+void FractalService::Stub::async::CalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest* request, ::grpc::ClientReadReactor< ::fractal::FrameChunk>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::fractal::FrameChunk>::Create(stub_->channel_.get(), stub_->rpcmethod_CalculateJuliaStream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::fractal::FrameChunk>* FractalService::Stub::AsyncCalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fractal::FrameChunk>::Create(channel_.get(), cq, rpcmethod_CalculateJuliaStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::fractal::FrameChunk>* FractalService::Stub::PrepareAsyncCalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fractal::FrameChunk>::Create(channel_.get(), cq, rpcmethod_CalculateJuliaStream_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::fractal::TrajectoryFrame>* FractalService::Stub::RenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::fractal::TrajectoryFrame>::Create(channel_.get(), rpcmethod_RenderTrajectory_, context, request);
+}
+
+void FractalService::Stub::async::RenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest* request, ::grpc::ClientReadReactor< ::fractal::TrajectoryFrame>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::fractal::TrajectoryFrame>::Create(stub_->channel_.get(), stub_->rpcmethod_RenderTrajectory_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>* FractalService::Stub::AsyncRenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fractal::TrajectoryFrame>::Create(channel_.get(), cq, rpcmethod_RenderTrajectory_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>* FractalService::Stub::PrepareAsyncRenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fractal::TrajectoryFrame>::Create(channel_.get(), cq, rpcmethod_RenderTrajectory_, context, request, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>* FractalService::Stub::InteractiveSessionRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::fractal::SessionUpdate, ::fractal::SessionFrame>::Create(channel_.get(), rpcmethod_InteractiveSession_, context);
+}
+
+void FractalService::Stub::async::InteractiveSession(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::fractal::SessionUpdate,::fractal::SessionFrame>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::fractal::SessionUpdate,::fractal::SessionFrame>::Create(stub_->channel_.get(), stub_->rpcmethod_InteractiveSession_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>* FractalService::Stub::AsyncInteractiveSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::fractal::SessionUpdate, ::fractal::SessionFrame>::Create(channel_.get(), cq, rpcmethod_InteractiveSession_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>* FractalService::Stub::PrepareAsyncInteractiveSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::fractal::SessionUpdate, ::fractal::SessionFrame>::Create(channel_.get(), cq, rpcmethod_InteractiveSession_, context, false, nullptr);
+}
+
 ::grpc::Status FractalService::Stub::Shutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::fractal::ShutdownResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::fractal::ShutdownRequest, ::fractal::ShutdownResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Shutdown_, context, request, response);
 }
@@ -83,6 +157,29 @@ void FractalService::Stub::async::Shutdown(::grpc::ClientContext* context, const
   return result;
 }
 
+::grpc::Status FractalService::Stub::GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::fractal::ServerStatsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetServerStats_, context, request, response);
+}
+
+void FractalService::Stub::async::GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetServerStats_, context, request, response, std::move(f));
+}
+
+void FractalService::Stub::async::GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetServerStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>* FractalService::Stub::PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::fractal::ServerStatsResponse, ::fractal::ServerStatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetServerStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>* FractalService::Stub::AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetServerStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 FractalService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FractalService_method_names[0],
@@ -96,6 +193,46 @@ FractalService::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FractalService_method_names[1],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< FractalService::Service, ::fractal::JuliaBatchRequest, ::fractal::JuliaBatchResponse>(
+          [](FractalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fractal::JuliaBatchRequest* req,
+             ::grpc::ServerWriter<::fractal::JuliaBatchResponse>* writer) {
+               return service->CalculateJuliaBatch(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FractalService_method_names[2],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< FractalService::Service, ::fractal::JuliaRequest, ::fractal::FrameChunk>(
+          [](FractalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fractal::JuliaRequest* req,
+             ::grpc::ServerWriter<::fractal::FrameChunk>* writer) {
+               return service->CalculateJuliaStream(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FractalService_method_names[3],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< FractalService::Service, ::fractal::TrajectoryRequest, ::fractal::TrajectoryFrame>(
+          [](FractalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fractal::TrajectoryRequest* req,
+             ::grpc::ServerWriter<::fractal::TrajectoryFrame>* writer) {
+               return service->RenderTrajectory(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FractalService_method_names[4],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< FractalService::Service, ::fractal::SessionUpdate, ::fractal::SessionFrame>(
+          [](FractalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::fractal::SessionFrame,
+             ::fractal::SessionUpdate>* stream) {
+               return service->InteractiveSession(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FractalService_method_names[5],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< FractalService::Service, ::fractal::ShutdownRequest, ::fractal::ShutdownResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](FractalService::Service* service,
@@ -104,6 +241,16 @@ FractalService::Service::Service() {
              ::fractal::ShutdownResponse* resp) {
                return service->Shutdown(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FractalService_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FractalService::Service, ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FractalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fractal::ServerStatsRequest* req,
+             ::fractal::ServerStatsResponse* resp) {
+               return service->GetServerStats(ctx, req, resp);
+             }, this)));
 }
 
 FractalService::Service::~Service() {
@@ -116,6 +263,33 @@ FractalService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status FractalService::Service::CalculateJuliaBatch(::grpc::ServerContext* context, const ::fractal::JuliaBatchRequest* request, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FractalService::Service::CalculateJuliaStream(::grpc::ServerContext* context, const ::fractal::JuliaRequest* request, ::grpc::ServerWriter< ::fractal::FrameChunk>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FractalService::Service::RenderTrajectory(::grpc::ServerContext* context, const ::fractal::TrajectoryRequest* request, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FractalService::Service::InteractiveSession(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status FractalService::Service::Shutdown(::grpc::ServerContext* context, const ::fractal::ShutdownRequest* request, ::fractal::ShutdownResponse* response) {
   (void) context;
   (void) request;
@@ -123,6 +297,13 @@ FractalService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status FractalService::Service::GetServerStats(::grpc::ServerContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace fractal
 
@@ -42,6 +42,42 @@ class FractalService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::JuliaResponse>> PrepareAsyncCalculateJulia(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::JuliaResponse>>(PrepareAsyncCalculateJuliaRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::fractal::JuliaBatchResponse>> CalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::fractal::JuliaBatchResponse>>(CalculateJuliaBatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::JuliaBatchResponse>> AsyncCalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::JuliaBatchResponse>>(AsyncCalculateJuliaBatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::JuliaBatchResponse>> PrepareAsyncCalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::JuliaBatchResponse>>(PrepareAsyncCalculateJuliaBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::fractal::FrameChunk>> CalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::fractal::FrameChunk>>(CalculateJuliaStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::FrameChunk>> AsyncCalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::FrameChunk>>(AsyncCalculateJuliaStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::FrameChunk>> PrepareAsyncCalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::FrameChunk>>(PrepareAsyncCalculateJuliaStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::fractal::TrajectoryFrame>> RenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::fractal::TrajectoryFrame>>(RenderTrajectoryRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::TrajectoryFrame>> AsyncRenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::TrajectoryFrame>>(AsyncRenderTrajectoryRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::TrajectoryFrame>> PrepareAsyncRenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fractal::TrajectoryFrame>>(PrepareAsyncRenderTrajectoryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>> InteractiveSession(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>>(InteractiveSessionRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>> AsyncInteractiveSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>>(AsyncInteractiveSessionRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>> PrepareAsyncInteractiveSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>>(PrepareAsyncInteractiveSessionRaw(context, cq));
+    }
     virtual ::grpc::Status Shutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::fractal::ShutdownResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ShutdownResponse>> AsyncShutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ShutdownResponse>>(AsyncShutdownRaw(context, request, cq));
@@ -49,13 +85,26 @@ class FractalService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ShutdownResponse>> PrepareAsyncShutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ShutdownResponse>>(PrepareAsyncShutdownRaw(context, request, cq));
     }
+    virtual ::grpc::Status GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::fractal::ServerStatsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ServerStatsResponse>> AsyncGetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ServerStatsResponse>>(AsyncGetServerStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ServerStatsResponse>> PrepareAsyncGetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ServerStatsResponse>>(PrepareAsyncGetServerStatsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
       virtual void CalculateJulia(::grpc::ClientContext* context, const ::fractal::JuliaRequest* request, ::fractal::JuliaResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void CalculateJulia(::grpc::ClientContext* context, const ::fractal::JuliaRequest* request, ::fractal::JuliaResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void CalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest* request, ::grpc::ClientReadReactor< ::fractal::JuliaBatchResponse>* reactor) = 0;
+      virtual void CalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest* request, ::grpc::ClientReadReactor< ::fractal::FrameChunk>* reactor) = 0;
+      virtual void RenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest* request, ::grpc::ClientReadReactor< ::fractal::TrajectoryFrame>* reactor) = 0;
+      virtual void InteractiveSession(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::fractal::SessionUpdate,::fractal::SessionFrame>* reactor) = 0;
       virtual void Shutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest* request, ::fractal::ShutdownResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void Shutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest* request, ::fractal::ShutdownResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -63,8 +112,22 @@ class FractalService final {
    private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fractal::JuliaResponse>* AsyncCalculateJuliaRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fractal::JuliaResponse>* PrepareAsyncCalculateJuliaRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::fractal::JuliaBatchResponse>* CalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fractal::JuliaBatchResponse>* AsyncCalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fractal::JuliaBatchResponse>* PrepareAsyncCalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::fractal::FrameChunk>* CalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fractal::FrameChunk>* AsyncCalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fractal::FrameChunk>* PrepareAsyncCalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::fractal::TrajectoryFrame>* RenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fractal::TrajectoryFrame>* AsyncRenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fractal::TrajectoryFrame>* PrepareAsyncRenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>* InteractiveSessionRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>* AsyncInteractiveSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::fractal::SessionUpdate, ::fractal::SessionFrame>* PrepareAsyncInteractiveSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ShutdownResponse>* AsyncShutdownRaw(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ShutdownResponse>* PrepareAsyncShutdownRaw(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ServerStatsResponse>* AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fractal::ServerStatsResponse>* PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -76,6 +139,42 @@ class FractalService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::JuliaResponse>> PrepareAsyncCalculateJulia(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::JuliaResponse>>(PrepareAsyncCalculateJuliaRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::fractal::JuliaBatchResponse>> CalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::fractal::JuliaBatchResponse>>(CalculateJuliaBatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>> AsyncCalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>>(AsyncCalculateJuliaBatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>> PrepareAsyncCalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>>(PrepareAsyncCalculateJuliaBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::fractal::FrameChunk>> CalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::fractal::FrameChunk>>(CalculateJuliaStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::FrameChunk>> AsyncCalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::FrameChunk>>(AsyncCalculateJuliaStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::FrameChunk>> PrepareAsyncCalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::FrameChunk>>(PrepareAsyncCalculateJuliaStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::fractal::TrajectoryFrame>> RenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::fractal::TrajectoryFrame>>(RenderTrajectoryRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>> AsyncRenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>>(AsyncRenderTrajectoryRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>> PrepareAsyncRenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>>(PrepareAsyncRenderTrajectoryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>> InteractiveSession(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>>(InteractiveSessionRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>> AsyncInteractiveSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>>(AsyncInteractiveSessionRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>> PrepareAsyncInteractiveSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>>(PrepareAsyncInteractiveSessionRaw(context, cq));
+    }
     ::grpc::Status Shutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::fractal::ShutdownResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ShutdownResponse>> AsyncShutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ShutdownResponse>>(AsyncShutdownRaw(context, request, cq));
@@ -83,13 +182,26 @@ class FractalService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ShutdownResponse>> PrepareAsyncShutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ShutdownResponse>>(PrepareAsyncShutdownRaw(context, request, cq));
     }
+    ::grpc::Status GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::fractal::ServerStatsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>> AsyncGetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>>(AsyncGetServerStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>> PrepareAsyncGetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>>(PrepareAsyncGetServerStatsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
       void CalculateJulia(::grpc::ClientContext* context, const ::fractal::JuliaRequest* request, ::fractal::JuliaResponse* response, std::function<void(::grpc::Status)>) override;
       void CalculateJulia(::grpc::ClientContext* context, const ::fractal::JuliaRequest* request, ::fractal::JuliaResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void CalculateJuliaBatch(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest* request, ::grpc::ClientReadReactor< ::fractal::JuliaBatchResponse>* reactor) override;
+      void CalculateJuliaStream(::grpc::ClientContext* context, const ::fractal::JuliaRequest* request, ::grpc::ClientReadReactor< ::fractal::FrameChunk>* reactor) override;
+      void RenderTrajectory(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest* request, ::grpc::ClientReadReactor< ::fractal::TrajectoryFrame>* reactor) override;
+      void InteractiveSession(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::fractal::SessionUpdate,::fractal::SessionFrame>* reactor) override;
       void Shutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest* request, ::fractal::ShutdownResponse* response, std::function<void(::grpc::Status)>) override;
       void Shutdown(::grpc::ClientContext* context, const ::fractal::ShutdownRequest* request, ::fractal::ShutdownResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetServerStats(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -103,10 +215,29 @@ class FractalService final {
     class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::fractal::JuliaResponse>* AsyncCalculateJuliaRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::fractal::JuliaResponse>* PrepareAsyncCalculateJuliaRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::fractal::JuliaBatchResponse>* CalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request) override;
+    ::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>* AsyncCalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::fractal::JuliaBatchResponse>* PrepareAsyncCalculateJuliaBatchRaw(::grpc::ClientContext* context, const ::fractal::JuliaBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::fractal::FrameChunk>* CalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request) override;
+    ::grpc::ClientAsyncReader< ::fractal::FrameChunk>* AsyncCalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::fractal::FrameChunk>* PrepareAsyncCalculateJuliaStreamRaw(::grpc::ClientContext* context, const ::fractal::JuliaRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::fractal::TrajectoryFrame>* RenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request) override;
+    ::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>* AsyncRenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::fractal::TrajectoryFrame>* PrepareAsyncRenderTrajectoryRaw(::grpc::ClientContext* context, const ::fractal::TrajectoryRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>* InteractiveSessionRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>* AsyncInteractiveSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::fractal::SessionUpdate, ::fractal::SessionFrame>* PrepareAsyncInteractiveSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::fractal::ShutdownResponse>* AsyncShutdownRaw(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::fractal::ShutdownResponse>* PrepareAsyncShutdownRaw(::grpc::ClientContext* context, const ::fractal::ShutdownRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>* AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fractal::ServerStatsResponse>* PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::fractal::ServerStatsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_CalculateJulia_;
+    const ::grpc::internal::RpcMethod rpcmethod_CalculateJuliaBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_CalculateJuliaStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_RenderTrajectory_;
+    const ::grpc::internal::RpcMethod rpcmethod_InteractiveSession_;
     const ::grpc::internal::RpcMethod rpcmethod_Shutdown_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetServerStats_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -115,7 +246,12 @@ class FractalService final {
     Service();
     virtual ~Service();
     virtual ::grpc::Status CalculateJulia(::grpc::ServerContext* context, const ::fractal::JuliaRequest* request, ::fractal::JuliaResponse* response);
+    virtual ::grpc::Status CalculateJuliaBatch(::grpc::ServerContext* context, const ::fractal::JuliaBatchRequest* request, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* writer);
+    virtual ::grpc::Status CalculateJuliaStream(::grpc::ServerContext* context, const ::fractal::JuliaRequest* request, ::grpc::ServerWriter< ::fractal::FrameChunk>* writer);
+    virtual ::grpc::Status RenderTrajectory(::grpc::ServerContext* context, const ::fractal::TrajectoryRequest* request, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* writer);
+    virtual ::grpc::Status InteractiveSession(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* stream);
     virtual ::grpc::Status Shutdown(::grpc::ServerContext* context, const ::fractal::ShutdownRequest* request, ::fractal::ShutdownResponse* response);
+    virtual ::grpc::Status GetServerStats(::grpc::ServerContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_CalculateJulia : public BaseClass {
@@ -138,12 +274,92 @@ class FractalService final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_CalculateJuliaBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_CalculateJuliaBatch() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_CalculateJuliaBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaBatch(::grpc::ServerContext* /*context*/, const ::fractal::JuliaBatchRequest* /*request*/, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCalculateJuliaBatch(::grpc::ServerContext* context, ::fractal::JuliaBatchRequest* request, ::grpc::ServerAsyncWriter< ::fractal::JuliaBatchResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_CalculateJuliaStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_CalculateJuliaStream() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_CalculateJuliaStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaStream(::grpc::ServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/, ::grpc::ServerWriter< ::fractal::FrameChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCalculateJuliaStream(::grpc::ServerContext* context, ::fractal::JuliaRequest* request, ::grpc::ServerAsyncWriter< ::fractal::FrameChunk>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_RenderTrajectory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_RenderTrajectory() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_RenderTrajectory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RenderTrajectory(::grpc::ServerContext* /*context*/, const ::fractal::TrajectoryRequest* /*request*/, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRenderTrajectory(::grpc::ServerContext* context, ::fractal::TrajectoryRequest* request, ::grpc::ServerAsyncWriter< ::fractal::TrajectoryFrame>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(3, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_InteractiveSession : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_InteractiveSession() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_InteractiveSession() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InteractiveSession(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestInteractiveSession(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_Shutdown : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_Shutdown() {
-      ::grpc::Service::MarkMethodAsync(1);
+      ::grpc::Service::MarkMethodAsync(5);
     }
     ~WithAsyncMethod_Shutdown() override {
       BaseClassMustBeDerivedFromService(this);
@@ -154,10 +370,30 @@ class FractalService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestShutdown(::grpc::ServerContext* context, ::fractal::ShutdownRequest* request, ::grpc::ServerAsyncResponseWriter< ::fractal::ShutdownResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::fractal::ServerStatsRequest* /*request*/, ::fractal::ServerStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetServerStats(::grpc::ServerContext* context, ::fractal::ServerStatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::fractal::ServerStatsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_CalculateJulia<WithAsyncMethod_Shutdown<Service > > AsyncService;
+  typedef WithAsyncMethod_CalculateJulia<WithAsyncMethod_CalculateJuliaBatch<WithAsyncMethod_CalculateJuliaStream<WithAsyncMethod_RenderTrajectory<WithAsyncMethod_InteractiveSession<WithAsyncMethod_Shutdown<WithAsyncMethod_GetServerStats<Service > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_CalculateJulia : public BaseClass {
    private:
@@ -186,18 +422,107 @@ class FractalService final {
       ::grpc::CallbackServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/, ::fractal::JuliaResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_CalculateJuliaBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_CalculateJuliaBatch() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::fractal::JuliaBatchRequest, ::fractal::JuliaBatchResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fractal::JuliaBatchRequest* request) { return this->CalculateJuliaBatch(context, request); }));
+    }
+    ~WithCallbackMethod_CalculateJuliaBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaBatch(::grpc::ServerContext* /*context*/, const ::fractal::JuliaBatchRequest* /*request*/, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::fractal::JuliaBatchResponse>* CalculateJuliaBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::fractal::JuliaBatchRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_CalculateJuliaStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_CalculateJuliaStream() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::fractal::JuliaRequest, ::fractal::FrameChunk>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fractal::JuliaRequest* request) { return this->CalculateJuliaStream(context, request); }));
+    }
+    ~WithCallbackMethod_CalculateJuliaStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaStream(::grpc::ServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/, ::grpc::ServerWriter< ::fractal::FrameChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::fractal::FrameChunk>* CalculateJuliaStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_RenderTrajectory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_RenderTrajectory() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::fractal::TrajectoryRequest, ::fractal::TrajectoryFrame>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fractal::TrajectoryRequest* request) { return this->RenderTrajectory(context, request); }));
+    }
+    ~WithCallbackMethod_RenderTrajectory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RenderTrajectory(::grpc::ServerContext* /*context*/, const ::fractal::TrajectoryRequest* /*request*/, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::fractal::TrajectoryFrame>* RenderTrajectory(
+      ::grpc::CallbackServerContext* /*context*/, const ::fractal::TrajectoryRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_InteractiveSession : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_InteractiveSession() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::fractal::SessionUpdate, ::fractal::SessionFrame>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->InteractiveSession(context); }));
+    }
+    ~WithCallbackMethod_InteractiveSession() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InteractiveSession(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::fractal::SessionUpdate, ::fractal::SessionFrame>* InteractiveSession(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_Shutdown : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_Shutdown() {
-      ::grpc::Service::MarkMethodCallback(1,
+      ::grpc::Service::MarkMethodCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::fractal::ShutdownRequest, ::fractal::ShutdownResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::fractal::ShutdownRequest* request, ::fractal::ShutdownResponse* response) { return this->Shutdown(context, request, response); }));}
     void SetMessageAllocatorFor_Shutdown(
         ::grpc::MessageAllocator< ::fractal::ShutdownRequest, ::fractal::ShutdownResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::fractal::ShutdownRequest, ::fractal::ShutdownResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -212,7 +537,34 @@ class FractalService final {
     virtual ::grpc::ServerUnaryReactor* Shutdown(
       ::grpc::CallbackServerContext* /*context*/, const ::fractal::ShutdownRequest* /*request*/, ::fractal::ShutdownResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_CalculateJulia<WithCallbackMethod_Shutdown<Service > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fractal::ServerStatsRequest* request, ::fractal::ServerStatsResponse* response) { return this->GetServerStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetServerStats(
+        ::grpc::MessageAllocator< ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::fractal::ServerStatsRequest* /*request*/, ::fractal::ServerStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetServerStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::fractal::ServerStatsRequest* /*request*/, ::fractal::ServerStatsResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_CalculateJulia<WithCallbackMethod_CalculateJuliaBatch<WithCallbackMethod_CalculateJuliaStream<WithCallbackMethod_RenderTrajectory<WithCallbackMethod_InteractiveSession<WithCallbackMethod_Shutdown<WithCallbackMethod_GetServerStats<Service > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_CalculateJulia : public BaseClass {
@@ -232,12 +584,80 @@ class FractalService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_CalculateJuliaBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_CalculateJuliaBatch() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_CalculateJuliaBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaBatch(::grpc::ServerContext* /*context*/, const ::fractal::JuliaBatchRequest* /*request*/, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_CalculateJuliaStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_CalculateJuliaStream() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_CalculateJuliaStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaStream(::grpc::ServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/, ::grpc::ServerWriter< ::fractal::FrameChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_RenderTrajectory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_RenderTrajectory() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_RenderTrajectory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RenderTrajectory(::grpc::ServerContext* /*context*/, const ::fractal::TrajectoryRequest* /*request*/, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_InteractiveSession : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_InteractiveSession() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_InteractiveSession() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InteractiveSession(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_Shutdown : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_Shutdown() {
-      ::grpc::Service::MarkMethodGeneric(1);
+      ::grpc::Service::MarkMethodGeneric(5);
     }
     ~WithGenericMethod_Shutdown() override {
       BaseClassMustBeDerivedFromService(this);
@@ -249,6 +669,23 @@ class FractalService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::fractal::ServerStatsRequest* /*request*/, ::fractal::ServerStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_CalculateJulia : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -269,12 +706,92 @@ class FractalService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_CalculateJuliaBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CalculateJuliaBatch() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_CalculateJuliaBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaBatch(::grpc::ServerContext* /*context*/, const ::fractal::JuliaBatchRequest* /*request*/, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCalculateJuliaBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CalculateJuliaStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CalculateJuliaStream() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_CalculateJuliaStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaStream(::grpc::ServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/, ::grpc::ServerWriter< ::fractal::FrameChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCalculateJuliaStream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_RenderTrajectory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RenderTrajectory() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_RenderTrajectory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RenderTrajectory(::grpc::ServerContext* /*context*/, const ::fractal::TrajectoryRequest* /*request*/, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRenderTrajectory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(3, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_InteractiveSession : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_InteractiveSession() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_InteractiveSession() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InteractiveSession(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestInteractiveSession(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Shutdown : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_Shutdown() {
-      ::grpc::Service::MarkMethodRaw(1);
+      ::grpc::Service::MarkMethodRaw(5);
     }
     ~WithRawMethod_Shutdown() override {
       BaseClassMustBeDerivedFromService(this);
@@ -285,7 +802,27 @@ class FractalService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestShutdown(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::fractal::ServerStatsRequest* /*request*/, ::fractal::ServerStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetServerStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -311,12 +848,101 @@ class FractalService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_CalculateJuliaBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CalculateJuliaBatch() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->CalculateJuliaBatch(context, request); }));
+    }
+    ~WithRawCallbackMethod_CalculateJuliaBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaBatch(::grpc::ServerContext* /*context*/, const ::fractal::JuliaBatchRequest* /*request*/, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* CalculateJuliaBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CalculateJuliaStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CalculateJuliaStream() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->CalculateJuliaStream(context, request); }));
+    }
+    ~WithRawCallbackMethod_CalculateJuliaStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CalculateJuliaStream(::grpc::ServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/, ::grpc::ServerWriter< ::fractal::FrameChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* CalculateJuliaStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_RenderTrajectory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_RenderTrajectory() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->RenderTrajectory(context, request); }));
+    }
+    ~WithRawCallbackMethod_RenderTrajectory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RenderTrajectory(::grpc::ServerContext* /*context*/, const ::fractal::TrajectoryRequest* /*request*/, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* RenderTrajectory(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_InteractiveSession : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_InteractiveSession() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->InteractiveSession(context); }));
+    }
+    ~WithRawCallbackMethod_InteractiveSession() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InteractiveSession(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::fractal::SessionFrame, ::fractal::SessionUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* InteractiveSession(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Shutdown : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_Shutdown() {
-      ::grpc::Service::MarkMethodRawCallback(1,
+      ::grpc::Service::MarkMethodRawCallback(5,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Shutdown(context, request, response); }));
@@ -333,6 +959,28 @@ class FractalService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetServerStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::fractal::ServerStatsRequest* /*request*/, ::fractal::ServerStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetServerStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_CalculateJulia : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -365,7 +1013,7 @@ class FractalService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_Shutdown() {
-      ::grpc::Service::MarkMethodStreamed(1,
+      ::grpc::Service::MarkMethodStreamed(5,
         new ::grpc::internal::StreamedUnaryHandler<
           ::fractal::ShutdownRequest, ::fractal::ShutdownResponse>(
             [this](::grpc::ServerContext* context,
@@ -386,9 +1034,117 @@ class FractalService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedShutdown(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::fractal::ShutdownRequest,::fractal::ShutdownResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_CalculateJulia<WithStreamedUnaryMethod_Shutdown<Service > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_CalculateJulia<WithStreamedUnaryMethod_Shutdown<Service > > StreamedService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::fractal::ServerStatsRequest, ::fractal::ServerStatsResponse>* streamer) {
+                       return this->StreamedGetServerStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::fractal::ServerStatsRequest* /*request*/, ::fractal::ServerStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetServerStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::fractal::ServerStatsRequest,::fractal::ServerStatsResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_CalculateJulia<WithStreamedUnaryMethod_Shutdown<WithStreamedUnaryMethod_GetServerStats<Service > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_CalculateJuliaBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_CalculateJuliaBatch() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::fractal::JuliaBatchRequest, ::fractal::JuliaBatchResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::fractal::JuliaBatchRequest, ::fractal::JuliaBatchResponse>* streamer) {
+                       return this->StreamedCalculateJuliaBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_CalculateJuliaBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CalculateJuliaBatch(::grpc::ServerContext* /*context*/, const ::fractal::JuliaBatchRequest* /*request*/, ::grpc::ServerWriter< ::fractal::JuliaBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedCalculateJuliaBatch(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::fractal::JuliaBatchRequest,::fractal::JuliaBatchResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_CalculateJuliaStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_CalculateJuliaStream() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::fractal::JuliaRequest, ::fractal::FrameChunk>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::fractal::JuliaRequest, ::fractal::FrameChunk>* streamer) {
+                       return this->StreamedCalculateJuliaStream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_CalculateJuliaStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CalculateJuliaStream(::grpc::ServerContext* /*context*/, const ::fractal::JuliaRequest* /*request*/, ::grpc::ServerWriter< ::fractal::FrameChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedCalculateJuliaStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::fractal::JuliaRequest,::fractal::FrameChunk>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_RenderTrajectory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_RenderTrajectory() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::fractal::TrajectoryRequest, ::fractal::TrajectoryFrame>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::fractal::TrajectoryRequest, ::fractal::TrajectoryFrame>* streamer) {
+                       return this->StreamedRenderTrajectory(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_RenderTrajectory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status RenderTrajectory(::grpc::ServerContext* /*context*/, const ::fractal::TrajectoryRequest* /*request*/, ::grpc::ServerWriter< ::fractal::TrajectoryFrame>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedRenderTrajectory(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::fractal::TrajectoryRequest,::fractal::TrajectoryFrame>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_CalculateJuliaBatch<WithSplitStreamingMethod_CalculateJuliaStream<WithSplitStreamingMethod_RenderTrajectory<Service > > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_CalculateJulia<WithSplitStreamingMethod_CalculateJuliaBatch<WithSplitStreamingMethod_CalculateJuliaStream<WithSplitStreamingMethod_RenderTrajectory<WithStreamedUnaryMethod_Shutdown<WithStreamedUnaryMethod_GetServerStats<Service > > > > > > StreamedService;
 };
 
 }  // namespace fractal
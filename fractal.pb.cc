@@ -33,6 +33,11 @@ PROTOBUF_CONSTEXPR JuliaRequest::JuliaRequest(
   , /*decltype(_impl_.x_max_)*/0
   , /*decltype(_impl_.y_min_)*/0
   , /*decltype(_impl_.y_max_)*/0
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.format_)*/0
+  , /*decltype(_impl_.theme_)*/0
+  , /*decltype(_impl_.progressive_)*/false
+  , /*decltype(_impl_.shared_memory_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct JuliaRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR JuliaRequestDefaultTypeInternal()
@@ -43,11 +48,32 @@ struct JuliaRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JuliaRequestDefaultTypeInternal _JuliaRequest_default_instance_;
+PROTOBUF_CONSTEXPR SharedFrame::SharedFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.instance_)*/uint64_t{0u}
+  , /*decltype(_impl_.position_)*/uint64_t{0u}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SharedFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SharedFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SharedFrameDefaultTypeInternal() {}
+  union {
+    SharedFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SharedFrameDefaultTypeInternal _SharedFrame_default_instance_;
 PROTOBUF_CONSTEXPR JuliaResponse::JuliaResponse(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.rgba_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.server_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shared_)*/nullptr
   , /*decltype(_impl_.calculation_time_ms_)*/0
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.format_)*/0
+  , /*decltype(_impl_.scale_)*/0
+  , /*decltype(_impl_.delta_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct JuliaResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR JuliaResponseDefaultTypeInternal()
@@ -58,6 +84,151 @@ struct JuliaResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JuliaResponseDefaultTypeInternal _JuliaResponse_default_instance_;
+PROTOBUF_CONSTEXPR JuliaBatchRequest::JuliaBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.requests_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JuliaBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JuliaBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JuliaBatchRequestDefaultTypeInternal() {}
+  union {
+    JuliaBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JuliaBatchRequestDefaultTypeInternal _JuliaBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR JuliaBatchResponse::JuliaBatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.response_)*/nullptr
+  , /*decltype(_impl_.index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JuliaBatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JuliaBatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JuliaBatchResponseDefaultTypeInternal() {}
+  union {
+    JuliaBatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JuliaBatchResponseDefaultTypeInternal _JuliaBatchResponse_default_instance_;
+PROTOBUF_CONSTEXPR FrameChunk::FrameChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.server_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.first_row_)*/0
+  , /*decltype(_impl_.rows_)*/0
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.format_)*/0
+  , /*decltype(_impl_.calculation_time_ms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrameChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameChunkDefaultTypeInternal() {}
+  union {
+    FrameChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameChunkDefaultTypeInternal _FrameChunk_default_instance_;
+PROTOBUF_CONSTEXPR TrajectoryRequest::TrajectoryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_)*/nullptr
+  , /*decltype(_impl_.step_real_)*/0
+  , /*decltype(_impl_.step_imag_)*/0
+  , /*decltype(_impl_.frame_count_)*/0
+  , /*decltype(_impl_.first_frame_)*/0
+  , /*decltype(_impl_.lookahead_)*/0
+  , /*decltype(_impl_.keyframe_interval_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TrajectoryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TrajectoryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TrajectoryRequestDefaultTypeInternal() {}
+  union {
+    TrajectoryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrajectoryRequestDefaultTypeInternal _TrajectoryRequest_default_instance_;
+PROTOBUF_CONSTEXPR TrajectoryFrame::TrajectoryFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.response_)*/nullptr
+  , /*decltype(_impl_.c_real_)*/0
+  , /*decltype(_impl_.c_imag_)*/0
+  , /*decltype(_impl_.frame_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TrajectoryFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TrajectoryFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TrajectoryFrameDefaultTypeInternal() {}
+  union {
+    TrajectoryFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrajectoryFrameDefaultTypeInternal _TrajectoryFrame_default_instance_;
+PROTOBUF_CONSTEXPR SessionUpdate::SessionUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_)*/nullptr
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionUpdateDefaultTypeInternal() {}
+  union {
+    SessionUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionUpdateDefaultTypeInternal _SessionUpdate_default_instance_;
+PROTOBUF_CONSTEXPR SessionFrame::SessionFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.response_)*/nullptr
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.dropped_updates_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionFrameDefaultTypeInternal() {}
+  union {
+    SessionFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionFrameDefaultTypeInternal _SessionFrame_default_instance_;
+PROTOBUF_CONSTEXPR ServerStatsRequest::ServerStatsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct ServerStatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatsRequestDefaultTypeInternal() {}
+  union {
+    ServerStatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatsRequestDefaultTypeInternal _ServerStatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR ServerStatsResponse::ServerStatsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.server_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cache_hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_misses_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_entries_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_capacity_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_evictions_)*/uint64_t{0u}
+  , /*decltype(_impl_.coalesced_requests_)*/uint64_t{0u}
+  , /*decltype(_impl_.disk_hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.disk_entries_)*/uint64_t{0u}
+  , /*decltype(_impl_.disk_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.disk_capacity_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerStatsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatsResponseDefaultTypeInternal() {}
+  union {
+    ServerStatsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatsResponseDefaultTypeInternal _ServerStatsResponse_default_instance_;
 PROTOBUF_CONSTEXPR ShutdownRequest::ShutdownRequest(
     ::_pbi::ConstantInitialized) {}
 struct ShutdownRequestDefaultTypeInternal {
@@ -83,8 +254,8 @@ struct ShutdownResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShutdownResponseDefaultTypeInternal _ShutdownResponse_default_instance_;
 }  // namespace fractal
-static ::_pb::Metadata file_level_metadata_fractal_2eproto[4];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_fractal_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_fractal_2eproto[14];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_fractal_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_fractal_2eproto = nullptr;
 
 const uint32_t TableStruct_fractal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -104,6 +275,21 @@ const uint32_t TableStruct_fractal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.x_max_),
   PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.y_min_),
   PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.y_max_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.theme_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.progressive_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaRequest, _impl_.shared_memory_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::SharedFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::SharedFrame, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::fractal::SharedFrame, _impl_.instance_),
+  PROTOBUF_FIELD_OFFSET(::fractal::SharedFrame, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::fractal::SharedFrame, _impl_.size_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -113,6 +299,103 @@ const uint32_t TableStruct_fractal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.rgba_data_),
   PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.calculation_time_ms_),
   PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.scale_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.delta_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaResponse, _impl_.shared_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaBatchRequest, _impl_.requests_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaBatchResponse, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::fractal::JuliaBatchResponse, _impl_.response_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _impl_.first_row_),
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _impl_.rows_),
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _impl_.calculation_time_ms_),
+  PROTOBUF_FIELD_OFFSET(::fractal::FrameChunk, _impl_.server_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _impl_.frame_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _impl_.step_real_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _impl_.step_imag_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _impl_.frame_count_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _impl_.first_frame_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _impl_.lookahead_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryRequest, _impl_.keyframe_interval_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryFrame, _impl_.frame_index_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryFrame, _impl_.c_real_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryFrame, _impl_.c_imag_),
+  PROTOBUF_FIELD_OFFSET(::fractal::TrajectoryFrame, _impl_.response_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::SessionUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::SessionUpdate, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::fractal::SessionUpdate, _impl_.frame_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::SessionFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::SessionFrame, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::fractal::SessionFrame, _impl_.response_),
+  PROTOBUF_FIELD_OFFSET(::fractal::SessionFrame, _impl_.dropped_updates_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.cache_hits_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.cache_misses_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.cache_entries_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.cache_bytes_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.cache_capacity_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.cache_evictions_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.coalesced_requests_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.disk_hits_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.disk_entries_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.disk_bytes_),
+  PROTOBUF_FIELD_OFFSET(::fractal::ServerStatsResponse, _impl_.disk_capacity_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::fractal::ShutdownRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -129,38 +412,107 @@ const uint32_t TableStruct_fractal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::fractal::JuliaRequest)},
-  { 16, -1, -1, sizeof(::fractal::JuliaResponse)},
-  { 25, -1, -1, sizeof(::fractal::ShutdownRequest)},
-  { 31, -1, -1, sizeof(::fractal::ShutdownResponse)},
+  { 21, -1, -1, sizeof(::fractal::SharedFrame)},
+  { 31, -1, -1, sizeof(::fractal::JuliaResponse)},
+  { 45, -1, -1, sizeof(::fractal::JuliaBatchRequest)},
+  { 52, -1, -1, sizeof(::fractal::JuliaBatchResponse)},
+  { 60, -1, -1, sizeof(::fractal::FrameChunk)},
+  { 73, -1, -1, sizeof(::fractal::TrajectoryRequest)},
+  { 86, -1, -1, sizeof(::fractal::TrajectoryFrame)},
+  { 96, -1, -1, sizeof(::fractal::SessionUpdate)},
+  { 104, -1, -1, sizeof(::fractal::SessionFrame)},
+  { 113, -1, -1, sizeof(::fractal::ServerStatsRequest)},
+  { 119, -1, -1, sizeof(::fractal::ServerStatsResponse)},
+  { 137, -1, -1, sizeof(::fractal::ShutdownRequest)},
+  { 143, -1, -1, sizeof(::fractal::ShutdownResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::fractal::_JuliaRequest_default_instance_._instance,
+  &::fractal::_SharedFrame_default_instance_._instance,
   &::fractal::_JuliaResponse_default_instance_._instance,
+  &::fractal::_JuliaBatchRequest_default_instance_._instance,
+  &::fractal::_JuliaBatchResponse_default_instance_._instance,
+  &::fractal::_FrameChunk_default_instance_._instance,
+  &::fractal::_TrajectoryRequest_default_instance_._instance,
+  &::fractal::_TrajectoryFrame_default_instance_._instance,
+  &::fractal::_SessionUpdate_default_instance_._instance,
+  &::fractal::_SessionFrame_default_instance_._instance,
+  &::fractal::_ServerStatsRequest_default_instance_._instance,
+  &::fractal::_ServerStatsResponse_default_instance_._instance,
   &::fractal::_ShutdownRequest_default_instance_._instance,
   &::fractal::_ShutdownResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_fractal_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\rfractal.proto\022\007fractal\"\266\001\n\014JuliaReques"
+  "\n\rfractal.proto\022\007fractal\"\301\002\n\014JuliaReques"
   "t\022\016\n\006c_real\030\001 \001(\001\022\016\n\006c_imag\030\002 \001(\001\022\r\n\005wid"
   "th\030\003 \001(\005\022\016\n\006height\030\004 \001(\005\022\026\n\016max_iteratio"
   "ns\030\005 \001(\005\022\023\n\013poly_degree\030\006 \001(\005\022\r\n\005x_min\030\007"
   " \001(\001\022\r\n\005x_max\030\010 \001(\001\022\r\n\005y_min\030\t \001(\001\022\r\n\005y_"
-  "max\030\n \001(\001\"R\n\rJuliaResponse\022\021\n\trgba_data\030"
-  "\001 \001(\014\022\033\n\023calculation_time_ms\030\002 \001(\001\022\021\n\tse"
-  "rver_id\030\003 \001(\t\"\021\n\017ShutdownRequest\"#\n\020Shut"
-  "downResponse\022\017\n\007message\030\001 \001(\t2\222\001\n\016Fracta"
-  "lService\022\?\n\016CalculateJulia\022\025.fractal.Jul"
-  "iaRequest\032\026.fractal.JuliaResponse\022\?\n\010Shu"
-  "tdown\022\030.fractal.ShutdownRequest\032\031.fracta"
-  "l.ShutdownResponseb\006proto3"
+  "max\030\n \001(\001\022(\n\010encoding\030\013 \001(\0162\026.fractal.Fr"
+  "ameEncoding\022$\n\006format\030\014 \001(\0162\024.fractal.Pi"
+  "xelFormat\022\r\n\005theme\030\r \001(\005\022\023\n\013progressive\030"
+  "\016 \001(\010\022\025\n\rshared_memory\030\017 \001(\010\"M\n\013SharedFr"
+  "ame\022\014\n\004name\030\001 \001(\t\022\020\n\010instance\030\002 \001(\004\022\020\n\010p"
+  "osition\030\003 \001(\004\022\014\n\004size\030\004 \001(\004\"\346\001\n\rJuliaRes"
+  "ponse\022\021\n\trgba_data\030\001 \001(\014\022\033\n\023calculation_"
+  "time_ms\030\002 \001(\001\022\021\n\tserver_id\030\003 \001(\t\022(\n\010enco"
+  "ding\030\004 \001(\0162\026.fractal.FrameEncoding\022$\n\006fo"
+  "rmat\030\005 \001(\0162\024.fractal.PixelFormat\022\r\n\005scal"
+  "e\030\006 \001(\005\022\r\n\005delta\030\007 \001(\010\022$\n\006shared\030\010 \001(\0132\024"
+  ".fractal.SharedFrame\"<\n\021JuliaBatchReques"
+  "t\022\'\n\010requests\030\001 \003(\0132\025.fractal.JuliaReque"
+  "st\"M\n\022JuliaBatchResponse\022\r\n\005index\030\001 \001(\005\022"
+  "(\n\010response\030\002 \001(\0132\026.fractal.JuliaRespons"
+  "e\"\273\001\n\nFrameChunk\022\021\n\tfirst_row\030\001 \001(\005\022\014\n\004r"
+  "ows\030\002 \001(\005\022\014\n\004data\030\003 \001(\014\022(\n\010encoding\030\004 \001("
+  "\0162\026.fractal.FrameEncoding\022$\n\006format\030\005 \001("
+  "\0162\024.fractal.PixelFormat\022\033\n\023calculation_t"
+  "ime_ms\030\006 \001(\001\022\021\n\tserver_id\030\007 \001(\t\"\267\001\n\021Traj"
+  "ectoryRequest\022$\n\005frame\030\001 \001(\0132\025.fractal.J"
+  "uliaRequest\022\021\n\tstep_real\030\002 \001(\001\022\021\n\tstep_i"
+  "mag\030\003 \001(\001\022\023\n\013frame_count\030\004 \001(\005\022\023\n\013first_"
+  "frame\030\005 \001(\005\022\021\n\tlookahead\030\006 \001(\005\022\031\n\021keyfra"
+  "me_interval\030\007 \001(\005\"p\n\017TrajectoryFrame\022\023\n\013"
+  "frame_index\030\001 \001(\005\022\016\n\006c_real\030\002 \001(\001\022\016\n\006c_i"
+  "mag\030\003 \001(\001\022(\n\010response\030\004 \001(\0132\026.fractal.Ju"
+  "liaResponse\"G\n\rSessionUpdate\022\020\n\010sequence"
+  "\030\001 \001(\004\022$\n\005frame\030\002 \001(\0132\025.fractal.JuliaReq"
+  "uest\"c\n\014SessionFrame\022\020\n\010sequence\030\001 \001(\004\022("
+  "\n\010response\030\002 \001(\0132\026.fractal.JuliaResponse"
+  "\022\027\n\017dropped_updates\030\003 \001(\r\"\024\n\022ServerStats"
+  "Request\"\237\002\n\023ServerStatsResponse\022\021\n\tserve"
+  "r_id\030\001 \001(\t\022\022\n\ncache_hits\030\002 \001(\004\022\024\n\014cache_"
+  "misses\030\003 \001(\004\022\025\n\rcache_entries\030\004 \001(\004\022\023\n\013c"
+  "ache_bytes\030\005 \001(\004\022\026\n\016cache_capacity\030\006 \001(\004"
+  "\022\027\n\017cache_evictions\030\007 \001(\004\022\032\n\022coalesced_r"
+  "equests\030\010 \001(\004\022\021\n\tdisk_hits\030\t \001(\004\022\024\n\014disk"
+  "_entries\030\n \001(\004\022\022\n\ndisk_bytes\030\013 \001(\004\022\025\n\rdi"
+  "sk_capacity\030\014 \001(\004\"\021\n\017ShutdownRequest\"#\n\020"
+  "ShutdownResponse\022\017\n\007message\030\001 \001(\t*8\n\rFra"
+  "meEncoding\022\007\n\003RAW\020\000\022\007\n\003QOI\020\001\022\013\n\007DEFLATE\020"
+  "\002\022\010\n\004XRLE\020\003*2\n\013PixelFormat\022\t\n\005RGBA8\020\000\022\014\n"
+  "\010PALETTE8\020\001\022\n\n\006ITER16\020\0022\214\004\n\016FractalServi"
+  "ce\022\?\n\016CalculateJulia\022\025.fractal.JuliaRequ"
+  "est\032\026.fractal.JuliaResponse\022P\n\023Calculate"
+  "JuliaBatch\022\032.fractal.JuliaBatchRequest\032\033"
+  ".fractal.JuliaBatchResponse0\001\022D\n\024Calcula"
+  "teJuliaStream\022\025.fractal.JuliaRequest\032\023.f"
+  "ractal.FrameChunk0\001\022J\n\020RenderTrajectory\022"
+  "\032.fractal.TrajectoryRequest\032\030.fractal.Tr"
+  "ajectoryFrame0\001\022G\n\022InteractiveSession\022\026."
+  "fractal.SessionUpdate\032\025.fractal.SessionF"
+  "rame(\0010\001\022\?\n\010Shutdown\022\030.fractal.ShutdownR"
+  "equest\032\031.fractal.ShutdownResponse\022K\n\016Get"
+  "ServerStats\022\033.fractal.ServerStatsRequest"
+  "\032\034.fractal.ServerStatsResponseb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_fractal_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_fractal_2eproto = {
-    false, false, 506, descriptor_table_protodef_fractal_2eproto,
+    false, false, 2478, descriptor_table_protodef_fractal_2eproto,
     "fractal.proto",
-    &descriptor_table_fractal_2eproto_once, nullptr, 0, 4,
+    &descriptor_table_fractal_2eproto_once, nullptr, 0, 14,
     schemas, file_default_instances, TableStruct_fractal_2eproto::offsets,
     file_level_metadata_fractal_2eproto, file_level_enum_descriptors_fractal_2eproto,
     file_level_service_descriptors_fractal_2eproto,
@@ -172,6 +524,37 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_fractal_
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_fractal_2eproto(&descriptor_table_fractal_2eproto);
 namespace fractal {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FrameEncoding_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_fractal_2eproto);
+  return file_level_enum_descriptors_fractal_2eproto[0];
+}
+bool FrameEncoding_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PixelFormat_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_fractal_2eproto);
+  return file_level_enum_descriptors_fractal_2eproto[1];
+}
+bool PixelFormat_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -199,12 +582,17 @@ JuliaRequest::JuliaRequest(const JuliaRequest& from)
     , decltype(_impl_.x_max_){}
     , decltype(_impl_.y_min_){}
     , decltype(_impl_.y_max_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.theme_){}
+    , decltype(_impl_.progressive_){}
+    , decltype(_impl_.shared_memory_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::memcpy(&_impl_.c_real_, &from._impl_.c_real_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_max_) -
-    reinterpret_cast<char*>(&_impl_.c_real_)) + sizeof(_impl_.y_max_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shared_memory_) -
+    reinterpret_cast<char*>(&_impl_.c_real_)) + sizeof(_impl_.shared_memory_));
   // @@protoc_insertion_point(copy_constructor:fractal.JuliaRequest)
 }
 
@@ -223,6 +611,11 @@ inline void JuliaRequest::SharedCtor(
     , decltype(_impl_.x_max_){0}
     , decltype(_impl_.y_min_){0}
     , decltype(_impl_.y_max_){0}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.format_){0}
+    , decltype(_impl_.theme_){0}
+    , decltype(_impl_.progressive_){false}
+    , decltype(_impl_.shared_memory_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -251,8 +644,8 @@ void JuliaRequest::Clear() {
   (void) cached_has_bits;
 
   ::memset(&_impl_.c_real_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.y_max_) -
-      reinterpret_cast<char*>(&_impl_.c_real_)) + sizeof(_impl_.y_max_));
+      reinterpret_cast<char*>(&_impl_.shared_memory_) -
+      reinterpret_cast<char*>(&_impl_.c_real_)) + sizeof(_impl_.shared_memory_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -342,6 +735,48 @@ const char* JuliaRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // .fractal.FrameEncoding encoding = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::fractal::FrameEncoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.PixelFormat format = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::fractal::PixelFormat>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 theme = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.theme_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool progressive = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.progressive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool shared_memory = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.shared_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -455,6 +890,38 @@ uint8_t* JuliaRequest::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_y_max(), target);
   }
 
+  // .fractal.FrameEncoding encoding = 11;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_encoding(), target);
+  }
+
+  // .fractal.PixelFormat format = 12;
+  if (this->_internal_format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      12, this->_internal_format(), target);
+  }
+
+  // int32 theme = 13;
+  if (this->_internal_theme() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_theme(), target);
+  }
+
+  // bool progressive = 14;
+  if (this->_internal_progressive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(14, this->_internal_progressive(), target);
+  }
+
+  // bool shared_memory = 15;
+  if (this->_internal_shared_memory() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_shared_memory(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -545,6 +1012,33 @@ size_t JuliaRequest::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
+  // .fractal.FrameEncoding encoding = 11;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+  }
+
+  // .fractal.PixelFormat format = 12;
+  if (this->_internal_format() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+  }
+
+  // int32 theme = 13;
+  if (this->_internal_theme() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_theme());
+  }
+
+  // bool progressive = 14;
+  if (this->_internal_progressive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool shared_memory = 15;
+  if (this->_internal_shared_memory() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -617,6 +1111,21 @@ void JuliaRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   if (raw_y_max != 0) {
     _this->_internal_set_y_max(from._internal_y_max());
   }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  if (from._internal_format() != 0) {
+    _this->_internal_set_format(from._internal_format());
+  }
+  if (from._internal_theme() != 0) {
+    _this->_internal_set_theme(from._internal_theme());
+  }
+  if (from._internal_progressive() != 0) {
+    _this->_internal_set_progressive(from._internal_progressive());
+  }
+  if (from._internal_shared_memory() != 0) {
+    _this->_internal_set_shared_memory(from._internal_shared_memory());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -635,8 +1144,8 @@ void JuliaRequest::InternalSwap(JuliaRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(JuliaRequest, _impl_.y_max_)
-      + sizeof(JuliaRequest::_impl_.y_max_)
+      PROTOBUF_FIELD_OFFSET(JuliaRequest, _impl_.shared_memory_)
+      + sizeof(JuliaRequest::_impl_.shared_memory_)
       - PROTOBUF_FIELD_OFFSET(JuliaRequest, _impl_.c_real_)>(
           reinterpret_cast<char*>(&_impl_.c_real_),
           reinterpret_cast<char*>(&other->_impl_.c_real_));
@@ -650,68 +1159,60 @@ void JuliaRequest::InternalSwap(JuliaRequest* other) {
 
 // ===================================================================
 
-class JuliaResponse::_Internal {
+class SharedFrame::_Internal {
  public:
 };
 
-JuliaResponse::JuliaResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SharedFrame::SharedFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fractal.JuliaResponse)
+  // @@protoc_insertion_point(arena_constructor:fractal.SharedFrame)
 }
-JuliaResponse::JuliaResponse(const JuliaResponse& from)
+SharedFrame::SharedFrame(const SharedFrame& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  JuliaResponse* const _this = this; (void)_this;
+  SharedFrame* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.rgba_data_){}
-    , decltype(_impl_.server_id_){}
-    , decltype(_impl_.calculation_time_ms_){}
+      decltype(_impl_.name_){}
+    , decltype(_impl_.instance_){}
+    , decltype(_impl_.position_){}
+    , decltype(_impl_.size_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.rgba_data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.rgba_data_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_rgba_data().empty()) {
-    _this->_impl_.rgba_data_.Set(from._internal_rgba_data(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.server_id_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.server_id_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_server_id().empty()) {
-    _this->_impl_.server_id_.Set(from._internal_server_id(), 
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.calculation_time_ms_ = from._impl_.calculation_time_ms_;
-  // @@protoc_insertion_point(copy_constructor:fractal.JuliaResponse)
+  ::memcpy(&_impl_.instance_, &from._impl_.instance_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.instance_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:fractal.SharedFrame)
 }
 
-inline void JuliaResponse::SharedCtor(
+inline void SharedFrame::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.rgba_data_){}
-    , decltype(_impl_.server_id_){}
-    , decltype(_impl_.calculation_time_ms_){0}
+      decltype(_impl_.name_){}
+    , decltype(_impl_.instance_){uint64_t{0u}}
+    , decltype(_impl_.position_){uint64_t{0u}}
+    , decltype(_impl_.size_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.rgba_data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.rgba_data_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.server_id_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.server_id_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-JuliaResponse::~JuliaResponse() {
-  // @@protoc_insertion_point(destructor:fractal.JuliaResponse)
+SharedFrame::~SharedFrame() {
+  // @@protoc_insertion_point(destructor:fractal.SharedFrame)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -719,58 +1220,65 @@ JuliaResponse::~JuliaResponse() {
   SharedDtor();
 }
 
-inline void JuliaResponse::SharedDtor() {
+inline void SharedFrame::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.rgba_data_.Destroy();
-  _impl_.server_id_.Destroy();
+  _impl_.name_.Destroy();
 }
 
-void JuliaResponse::SetCachedSize(int size) const {
+void SharedFrame::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void JuliaResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fractal.JuliaResponse)
+void SharedFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.SharedFrame)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.rgba_data_.ClearToEmpty();
-  _impl_.server_id_.ClearToEmpty();
-  _impl_.calculation_time_ms_ = 0;
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.instance_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.size_) -
+      reinterpret_cast<char*>(&_impl_.instance_)) + sizeof(_impl_.size_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* JuliaResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SharedFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bytes rgba_data = 1;
+      // string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_rgba_data();
+          auto str = _internal_mutable_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fractal.SharedFrame.name"));
         } else
           goto handle_unusual;
         continue;
-      // double calculation_time_ms = 2;
+      // uint64 instance = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          _impl_.calculation_time_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.instance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // string server_id = 3;
+      // uint64 position = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_server_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fractal.JuliaResponse.server_id"));
         } else
           goto handle_unusual;
         continue;
@@ -797,142 +1305,3056 @@ failure:
 #undef CHK_
 }
 
-uint8_t* JuliaResponse::_InternalSerialize(
+uint8_t* SharedFrame::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fractal.JuliaResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.SharedFrame)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bytes rgba_data = 1;
-  if (!this->_internal_rgba_data().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        1, this->_internal_rgba_data(), target);
-  }
-
-  // double calculation_time_ms = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_calculation_time_ms = this->_internal_calculation_time_ms();
-  uint64_t raw_calculation_time_ms;
-  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
-  if (raw_calculation_time_ms != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_calculation_time_ms(), target);
-  }
-
-  // string server_id = 3;
-  if (!this->_internal_server_id().empty()) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_server_id().data(), static_cast<int>(this->_internal_server_id().length()),
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fractal.JuliaResponse.server_id");
+      "fractal.SharedFrame.name");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_server_id(), target);
+        1, this->_internal_name(), target);
+  }
+
+  // uint64 instance = 2;
+  if (this->_internal_instance() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_instance(), target);
+  }
+
+  // uint64 position = 3;
+  if (this->_internal_position() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_position(), target);
+  }
+
+  // uint64 size = 4;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.SharedFrame)
+  return target;
+}
+
+size_t SharedFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.SharedFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 instance = 2;
+  if (this->_internal_instance() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_instance());
+  }
+
+  // uint64 position = 3;
+  if (this->_internal_position() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_position());
+  }
+
+  // uint64 size = 4;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SharedFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SharedFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SharedFrame::GetClassData() const { return &_class_data_; }
+
+
+void SharedFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SharedFrame*>(&to_msg);
+  auto& from = static_cast<const SharedFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.SharedFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_instance() != 0) {
+    _this->_internal_set_instance(from._internal_instance());
+  }
+  if (from._internal_position() != 0) {
+    _this->_internal_set_position(from._internal_position());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SharedFrame::CopyFrom(const SharedFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.SharedFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SharedFrame::IsInitialized() const {
+  return true;
+}
+
+void SharedFrame::InternalSwap(SharedFrame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SharedFrame, _impl_.size_)
+      + sizeof(SharedFrame::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(SharedFrame, _impl_.instance_)>(
+          reinterpret_cast<char*>(&_impl_.instance_),
+          reinterpret_cast<char*>(&other->_impl_.instance_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SharedFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[1]);
+}
+
+// ===================================================================
+
+class JuliaResponse::_Internal {
+ public:
+  static const ::fractal::SharedFrame& shared(const JuliaResponse* msg);
+};
+
+const ::fractal::SharedFrame&
+JuliaResponse::_Internal::shared(const JuliaResponse* msg) {
+  return *msg->_impl_.shared_;
+}
+JuliaResponse::JuliaResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.JuliaResponse)
+}
+JuliaResponse::JuliaResponse(const JuliaResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JuliaResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rgba_data_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.shared_){nullptr}
+    , decltype(_impl_.calculation_time_ms_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.scale_){}
+    , decltype(_impl_.delta_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rgba_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rgba_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rgba_data().empty()) {
+    _this->_impl_.rgba_data_.Set(from._internal_rgba_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.server_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_server_id().empty()) {
+    _this->_impl_.server_id_.Set(from._internal_server_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_shared()) {
+    _this->_impl_.shared_ = new ::fractal::SharedFrame(*from._impl_.shared_);
+  }
+  ::memcpy(&_impl_.calculation_time_ms_, &from._impl_.calculation_time_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.delta_) -
+    reinterpret_cast<char*>(&_impl_.calculation_time_ms_)) + sizeof(_impl_.delta_));
+  // @@protoc_insertion_point(copy_constructor:fractal.JuliaResponse)
+}
+
+inline void JuliaResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rgba_data_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.shared_){nullptr}
+    , decltype(_impl_.calculation_time_ms_){0}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.format_){0}
+    , decltype(_impl_.scale_){0}
+    , decltype(_impl_.delta_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rgba_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rgba_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.server_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+JuliaResponse::~JuliaResponse() {
+  // @@protoc_insertion_point(destructor:fractal.JuliaResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void JuliaResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rgba_data_.Destroy();
+  _impl_.server_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.shared_;
+}
+
+void JuliaResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void JuliaResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.JuliaResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rgba_data_.ClearToEmpty();
+  _impl_.server_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.shared_ != nullptr) {
+    delete _impl_.shared_;
+  }
+  _impl_.shared_ = nullptr;
+  ::memset(&_impl_.calculation_time_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.delta_) -
+      reinterpret_cast<char*>(&_impl_.calculation_time_ms_)) + sizeof(_impl_.delta_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* JuliaResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes rgba_data = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rgba_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double calculation_time_ms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.calculation_time_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string server_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_server_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fractal.JuliaResponse.server_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.FrameEncoding encoding = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::fractal::FrameEncoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.PixelFormat format = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::fractal::PixelFormat>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 scale = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.scale_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool delta = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.SharedFrame shared = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shared(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JuliaResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.JuliaResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes rgba_data = 1;
+  if (!this->_internal_rgba_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_rgba_data(), target);
+  }
+
+  // double calculation_time_ms = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_calculation_time_ms = this->_internal_calculation_time_ms();
+  uint64_t raw_calculation_time_ms;
+  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
+  if (raw_calculation_time_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_calculation_time_ms(), target);
+  }
+
+  // string server_id = 3;
+  if (!this->_internal_server_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_server_id().data(), static_cast<int>(this->_internal_server_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fractal.JuliaResponse.server_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_server_id(), target);
+  }
+
+  // .fractal.FrameEncoding encoding = 4;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_encoding(), target);
+  }
+
+  // .fractal.PixelFormat format = 5;
+  if (this->_internal_format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_format(), target);
+  }
+
+  // int32 scale = 6;
+  if (this->_internal_scale() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_scale(), target);
+  }
+
+  // bool delta = 7;
+  if (this->_internal_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_delta(), target);
+  }
+
+  // .fractal.SharedFrame shared = 8;
+  if (this->_internal_has_shared()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::shared(this),
+        _Internal::shared(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.JuliaResponse)
+  return target;
+}
+
+size_t JuliaResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.JuliaResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes rgba_data = 1;
+  if (!this->_internal_rgba_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_rgba_data());
+  }
+
+  // string server_id = 3;
+  if (!this->_internal_server_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_server_id());
+  }
+
+  // .fractal.SharedFrame shared = 8;
+  if (this->_internal_has_shared()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.shared_);
+  }
+
+  // double calculation_time_ms = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_calculation_time_ms = this->_internal_calculation_time_ms();
+  uint64_t raw_calculation_time_ms;
+  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
+  if (raw_calculation_time_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // .fractal.FrameEncoding encoding = 4;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+  }
+
+  // .fractal.PixelFormat format = 5;
+  if (this->_internal_format() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+  }
+
+  // int32 scale = 6;
+  if (this->_internal_scale() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_scale());
+  }
+
+  // bool delta = 7;
+  if (this->_internal_delta() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JuliaResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JuliaResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JuliaResponse::GetClassData() const { return &_class_data_; }
+
+
+void JuliaResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JuliaResponse*>(&to_msg);
+  auto& from = static_cast<const JuliaResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.JuliaResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rgba_data().empty()) {
+    _this->_internal_set_rgba_data(from._internal_rgba_data());
+  }
+  if (!from._internal_server_id().empty()) {
+    _this->_internal_set_server_id(from._internal_server_id());
+  }
+  if (from._internal_has_shared()) {
+    _this->_internal_mutable_shared()->::fractal::SharedFrame::MergeFrom(
+        from._internal_shared());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_calculation_time_ms = from._internal_calculation_time_ms();
+  uint64_t raw_calculation_time_ms;
+  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
+  if (raw_calculation_time_ms != 0) {
+    _this->_internal_set_calculation_time_ms(from._internal_calculation_time_ms());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  if (from._internal_format() != 0) {
+    _this->_internal_set_format(from._internal_format());
+  }
+  if (from._internal_scale() != 0) {
+    _this->_internal_set_scale(from._internal_scale());
+  }
+  if (from._internal_delta() != 0) {
+    _this->_internal_set_delta(from._internal_delta());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void JuliaResponse::CopyFrom(const JuliaResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.JuliaResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JuliaResponse::IsInitialized() const {
+  return true;
+}
+
+void JuliaResponse::InternalSwap(JuliaResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rgba_data_, lhs_arena,
+      &other->_impl_.rgba_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.server_id_, lhs_arena,
+      &other->_impl_.server_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(JuliaResponse, _impl_.delta_)
+      + sizeof(JuliaResponse::_impl_.delta_)
+      - PROTOBUF_FIELD_OFFSET(JuliaResponse, _impl_.shared_)>(
+          reinterpret_cast<char*>(&_impl_.shared_),
+          reinterpret_cast<char*>(&other->_impl_.shared_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JuliaResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[2]);
+}
+
+// ===================================================================
+
+class JuliaBatchRequest::_Internal {
+ public:
+};
+
+JuliaBatchRequest::JuliaBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.JuliaBatchRequest)
+}
+JuliaBatchRequest::JuliaBatchRequest(const JuliaBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JuliaBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){from._impl_.requests_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:fractal.JuliaBatchRequest)
+}
+
+inline void JuliaBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+JuliaBatchRequest::~JuliaBatchRequest() {
+  // @@protoc_insertion_point(destructor:fractal.JuliaBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void JuliaBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.requests_.~RepeatedPtrField();
+}
+
+void JuliaBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void JuliaBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.JuliaBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.requests_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* JuliaBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .fractal.JuliaRequest requests = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JuliaBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.JuliaBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .fractal.JuliaRequest requests = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_requests_size()); i < n; i++) {
+    const auto& repfield = this->_internal_requests(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.JuliaBatchRequest)
+  return target;
+}
+
+size_t JuliaBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.JuliaBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .fractal.JuliaRequest requests = 1;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->_impl_.requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JuliaBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JuliaBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JuliaBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void JuliaBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JuliaBatchRequest*>(&to_msg);
+  auto& from = static_cast<const JuliaBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.JuliaBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.requests_.MergeFrom(from._impl_.requests_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void JuliaBatchRequest::CopyFrom(const JuliaBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.JuliaBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JuliaBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void JuliaBatchRequest::InternalSwap(JuliaBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.requests_.InternalSwap(&other->_impl_.requests_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JuliaBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[3]);
+}
+
+// ===================================================================
+
+class JuliaBatchResponse::_Internal {
+ public:
+  static const ::fractal::JuliaResponse& response(const JuliaBatchResponse* msg);
+};
+
+const ::fractal::JuliaResponse&
+JuliaBatchResponse::_Internal::response(const JuliaBatchResponse* msg) {
+  return *msg->_impl_.response_;
+}
+JuliaBatchResponse::JuliaBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.JuliaBatchResponse)
+}
+JuliaBatchResponse::JuliaBatchResponse(const JuliaBatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JuliaBatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_response()) {
+    _this->_impl_.response_ = new ::fractal::JuliaResponse(*from._impl_.response_);
+  }
+  _this->_impl_.index_ = from._impl_.index_;
+  // @@protoc_insertion_point(copy_constructor:fractal.JuliaBatchResponse)
+}
+
+inline void JuliaBatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+JuliaBatchResponse::~JuliaBatchResponse() {
+  // @@protoc_insertion_point(destructor:fractal.JuliaBatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void JuliaBatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.response_;
+}
+
+void JuliaBatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void JuliaBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.JuliaBatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+  _impl_.index_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* JuliaBatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.JuliaResponse response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JuliaBatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.JuliaBatchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_index(), target);
+  }
+
+  // .fractal.JuliaResponse response = 2;
+  if (this->_internal_has_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.JuliaBatchResponse)
+  return target;
+}
+
+size_t JuliaBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.JuliaBatchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .fractal.JuliaResponse response = 2;
+  if (this->_internal_has_response()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+  }
+
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JuliaBatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JuliaBatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JuliaBatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void JuliaBatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JuliaBatchResponse*>(&to_msg);
+  auto& from = static_cast<const JuliaBatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.JuliaBatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_response()) {
+    _this->_internal_mutable_response()->::fractal::JuliaResponse::MergeFrom(
+        from._internal_response());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void JuliaBatchResponse::CopyFrom(const JuliaBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.JuliaBatchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JuliaBatchResponse::IsInitialized() const {
+  return true;
+}
+
+void JuliaBatchResponse::InternalSwap(JuliaBatchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(JuliaBatchResponse, _impl_.index_)
+      + sizeof(JuliaBatchResponse::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(JuliaBatchResponse, _impl_.response_)>(
+          reinterpret_cast<char*>(&_impl_.response_),
+          reinterpret_cast<char*>(&other->_impl_.response_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JuliaBatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[4]);
+}
+
+// ===================================================================
+
+class FrameChunk::_Internal {
+ public:
+};
+
+FrameChunk::FrameChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.FrameChunk)
+}
+FrameChunk::FrameChunk(const FrameChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrameChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.first_row_){}
+    , decltype(_impl_.rows_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.calculation_time_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.server_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_server_id().empty()) {
+    _this->_impl_.server_id_.Set(from._internal_server_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.first_row_, &from._impl_.first_row_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.calculation_time_ms_) -
+    reinterpret_cast<char*>(&_impl_.first_row_)) + sizeof(_impl_.calculation_time_ms_));
+  // @@protoc_insertion_point(copy_constructor:fractal.FrameChunk)
+}
+
+inline void FrameChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.first_row_){0}
+    , decltype(_impl_.rows_){0}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.format_){0}
+    , decltype(_impl_.calculation_time_ms_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.server_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FrameChunk::~FrameChunk() {
+  // @@protoc_insertion_point(destructor:fractal.FrameChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FrameChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+  _impl_.server_id_.Destroy();
+}
+
+void FrameChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FrameChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.FrameChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  _impl_.server_id_.ClearToEmpty();
+  ::memset(&_impl_.first_row_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.calculation_time_ms_) -
+      reinterpret_cast<char*>(&_impl_.first_row_)) + sizeof(_impl_.calculation_time_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FrameChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 first_row = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.first_row_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 rows = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.rows_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.FrameEncoding encoding = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::fractal::FrameEncoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.PixelFormat format = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::fractal::PixelFormat>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // double calculation_time_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.calculation_time_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string server_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_server_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fractal.FrameChunk.server_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FrameChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.FrameChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 first_row = 1;
+  if (this->_internal_first_row() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_first_row(), target);
+  }
+
+  // int32 rows = 2;
+  if (this->_internal_rows() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_rows(), target);
+  }
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  // .fractal.FrameEncoding encoding = 4;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_encoding(), target);
+  }
+
+  // .fractal.PixelFormat format = 5;
+  if (this->_internal_format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_format(), target);
+  }
+
+  // double calculation_time_ms = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_calculation_time_ms = this->_internal_calculation_time_ms();
+  uint64_t raw_calculation_time_ms;
+  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
+  if (raw_calculation_time_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_calculation_time_ms(), target);
+  }
+
+  // string server_id = 7;
+  if (!this->_internal_server_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_server_id().data(), static_cast<int>(this->_internal_server_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fractal.FrameChunk.server_id");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_server_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.FrameChunk)
+  return target;
+}
+
+size_t FrameChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.FrameChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // string server_id = 7;
+  if (!this->_internal_server_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_server_id());
+  }
+
+  // int32 first_row = 1;
+  if (this->_internal_first_row() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_first_row());
+  }
+
+  // int32 rows = 2;
+  if (this->_internal_rows() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_rows());
+  }
+
+  // .fractal.FrameEncoding encoding = 4;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+  }
+
+  // .fractal.PixelFormat format = 5;
+  if (this->_internal_format() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+  }
+
+  // double calculation_time_ms = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_calculation_time_ms = this->_internal_calculation_time_ms();
+  uint64_t raw_calculation_time_ms;
+  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
+  if (raw_calculation_time_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrameChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrameChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrameChunk::GetClassData() const { return &_class_data_; }
+
+
+void FrameChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrameChunk*>(&to_msg);
+  auto& from = static_cast<const FrameChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.FrameChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (!from._internal_server_id().empty()) {
+    _this->_internal_set_server_id(from._internal_server_id());
+  }
+  if (from._internal_first_row() != 0) {
+    _this->_internal_set_first_row(from._internal_first_row());
+  }
+  if (from._internal_rows() != 0) {
+    _this->_internal_set_rows(from._internal_rows());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  if (from._internal_format() != 0) {
+    _this->_internal_set_format(from._internal_format());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_calculation_time_ms = from._internal_calculation_time_ms();
+  uint64_t raw_calculation_time_ms;
+  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
+  if (raw_calculation_time_ms != 0) {
+    _this->_internal_set_calculation_time_ms(from._internal_calculation_time_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FrameChunk::CopyFrom(const FrameChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.FrameChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FrameChunk::IsInitialized() const {
+  return true;
+}
+
+void FrameChunk::InternalSwap(FrameChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.server_id_, lhs_arena,
+      &other->_impl_.server_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrameChunk, _impl_.calculation_time_ms_)
+      + sizeof(FrameChunk::_impl_.calculation_time_ms_)
+      - PROTOBUF_FIELD_OFFSET(FrameChunk, _impl_.first_row_)>(
+          reinterpret_cast<char*>(&_impl_.first_row_),
+          reinterpret_cast<char*>(&other->_impl_.first_row_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FrameChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[5]);
+}
+
+// ===================================================================
+
+class TrajectoryRequest::_Internal {
+ public:
+  static const ::fractal::JuliaRequest& frame(const TrajectoryRequest* msg);
+};
+
+const ::fractal::JuliaRequest&
+TrajectoryRequest::_Internal::frame(const TrajectoryRequest* msg) {
+  return *msg->_impl_.frame_;
+}
+TrajectoryRequest::TrajectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.TrajectoryRequest)
+}
+TrajectoryRequest::TrajectoryRequest(const TrajectoryRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TrajectoryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){nullptr}
+    , decltype(_impl_.step_real_){}
+    , decltype(_impl_.step_imag_){}
+    , decltype(_impl_.frame_count_){}
+    , decltype(_impl_.first_frame_){}
+    , decltype(_impl_.lookahead_){}
+    , decltype(_impl_.keyframe_interval_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_frame()) {
+    _this->_impl_.frame_ = new ::fractal::JuliaRequest(*from._impl_.frame_);
+  }
+  ::memcpy(&_impl_.step_real_, &from._impl_.step_real_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.keyframe_interval_) -
+    reinterpret_cast<char*>(&_impl_.step_real_)) + sizeof(_impl_.keyframe_interval_));
+  // @@protoc_insertion_point(copy_constructor:fractal.TrajectoryRequest)
+}
+
+inline void TrajectoryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){nullptr}
+    , decltype(_impl_.step_real_){0}
+    , decltype(_impl_.step_imag_){0}
+    , decltype(_impl_.frame_count_){0}
+    , decltype(_impl_.first_frame_){0}
+    , decltype(_impl_.lookahead_){0}
+    , decltype(_impl_.keyframe_interval_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TrajectoryRequest::~TrajectoryRequest() {
+  // @@protoc_insertion_point(destructor:fractal.TrajectoryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TrajectoryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.frame_;
+}
+
+void TrajectoryRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TrajectoryRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.TrajectoryRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_ != nullptr) {
+    delete _impl_.frame_;
+  }
+  _impl_.frame_ = nullptr;
+  ::memset(&_impl_.step_real_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.keyframe_interval_) -
+      reinterpret_cast<char*>(&_impl_.step_real_)) + sizeof(_impl_.keyframe_interval_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrajectoryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .fractal.JuliaRequest frame = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frame(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double step_real = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.step_real_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double step_imag = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.step_imag_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 frame_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.frame_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 first_frame = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.first_frame_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 lookahead = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.lookahead_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 keyframe_interval = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.keyframe_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TrajectoryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.TrajectoryRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .fractal.JuliaRequest frame = 1;
+  if (this->_internal_has_frame()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::frame(this),
+        _Internal::frame(this).GetCachedSize(), target, stream);
+  }
+
+  // double step_real = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_step_real = this->_internal_step_real();
+  uint64_t raw_step_real;
+  memcpy(&raw_step_real, &tmp_step_real, sizeof(tmp_step_real));
+  if (raw_step_real != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_step_real(), target);
+  }
+
+  // double step_imag = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_step_imag = this->_internal_step_imag();
+  uint64_t raw_step_imag;
+  memcpy(&raw_step_imag, &tmp_step_imag, sizeof(tmp_step_imag));
+  if (raw_step_imag != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_step_imag(), target);
+  }
+
+  // int32 frame_count = 4;
+  if (this->_internal_frame_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_frame_count(), target);
+  }
+
+  // int32 first_frame = 5;
+  if (this->_internal_first_frame() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_first_frame(), target);
+  }
+
+  // int32 lookahead = 6;
+  if (this->_internal_lookahead() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_lookahead(), target);
+  }
+
+  // int32 keyframe_interval = 7;
+  if (this->_internal_keyframe_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_keyframe_interval(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.TrajectoryRequest)
+  return target;
+}
+
+size_t TrajectoryRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.TrajectoryRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .fractal.JuliaRequest frame = 1;
+  if (this->_internal_has_frame()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.frame_);
+  }
+
+  // double step_real = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_step_real = this->_internal_step_real();
+  uint64_t raw_step_real;
+  memcpy(&raw_step_real, &tmp_step_real, sizeof(tmp_step_real));
+  if (raw_step_real != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double step_imag = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_step_imag = this->_internal_step_imag();
+  uint64_t raw_step_imag;
+  memcpy(&raw_step_imag, &tmp_step_imag, sizeof(tmp_step_imag));
+  if (raw_step_imag != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 frame_count = 4;
+  if (this->_internal_frame_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_frame_count());
+  }
+
+  // int32 first_frame = 5;
+  if (this->_internal_first_frame() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_first_frame());
+  }
+
+  // int32 lookahead = 6;
+  if (this->_internal_lookahead() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lookahead());
+  }
+
+  // int32 keyframe_interval = 7;
+  if (this->_internal_keyframe_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_keyframe_interval());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TrajectoryRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TrajectoryRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrajectoryRequest::GetClassData() const { return &_class_data_; }
+
+
+void TrajectoryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TrajectoryRequest*>(&to_msg);
+  auto& from = static_cast<const TrajectoryRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.TrajectoryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_frame()) {
+    _this->_internal_mutable_frame()->::fractal::JuliaRequest::MergeFrom(
+        from._internal_frame());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_step_real = from._internal_step_real();
+  uint64_t raw_step_real;
+  memcpy(&raw_step_real, &tmp_step_real, sizeof(tmp_step_real));
+  if (raw_step_real != 0) {
+    _this->_internal_set_step_real(from._internal_step_real());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_step_imag = from._internal_step_imag();
+  uint64_t raw_step_imag;
+  memcpy(&raw_step_imag, &tmp_step_imag, sizeof(tmp_step_imag));
+  if (raw_step_imag != 0) {
+    _this->_internal_set_step_imag(from._internal_step_imag());
+  }
+  if (from._internal_frame_count() != 0) {
+    _this->_internal_set_frame_count(from._internal_frame_count());
+  }
+  if (from._internal_first_frame() != 0) {
+    _this->_internal_set_first_frame(from._internal_first_frame());
+  }
+  if (from._internal_lookahead() != 0) {
+    _this->_internal_set_lookahead(from._internal_lookahead());
+  }
+  if (from._internal_keyframe_interval() != 0) {
+    _this->_internal_set_keyframe_interval(from._internal_keyframe_interval());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TrajectoryRequest::CopyFrom(const TrajectoryRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.TrajectoryRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrajectoryRequest::IsInitialized() const {
+  return true;
+}
+
+void TrajectoryRequest::InternalSwap(TrajectoryRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrajectoryRequest, _impl_.keyframe_interval_)
+      + sizeof(TrajectoryRequest::_impl_.keyframe_interval_)
+      - PROTOBUF_FIELD_OFFSET(TrajectoryRequest, _impl_.frame_)>(
+          reinterpret_cast<char*>(&_impl_.frame_),
+          reinterpret_cast<char*>(&other->_impl_.frame_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrajectoryRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[6]);
+}
+
+// ===================================================================
+
+class TrajectoryFrame::_Internal {
+ public:
+  static const ::fractal::JuliaResponse& response(const TrajectoryFrame* msg);
+};
+
+const ::fractal::JuliaResponse&
+TrajectoryFrame::_Internal::response(const TrajectoryFrame* msg) {
+  return *msg->_impl_.response_;
+}
+TrajectoryFrame::TrajectoryFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.TrajectoryFrame)
+}
+TrajectoryFrame::TrajectoryFrame(const TrajectoryFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TrajectoryFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.c_real_){}
+    , decltype(_impl_.c_imag_){}
+    , decltype(_impl_.frame_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_response()) {
+    _this->_impl_.response_ = new ::fractal::JuliaResponse(*from._impl_.response_);
+  }
+  ::memcpy(&_impl_.c_real_, &from._impl_.c_real_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.frame_index_) -
+    reinterpret_cast<char*>(&_impl_.c_real_)) + sizeof(_impl_.frame_index_));
+  // @@protoc_insertion_point(copy_constructor:fractal.TrajectoryFrame)
+}
+
+inline void TrajectoryFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.c_real_){0}
+    , decltype(_impl_.c_imag_){0}
+    , decltype(_impl_.frame_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TrajectoryFrame::~TrajectoryFrame() {
+  // @@protoc_insertion_point(destructor:fractal.TrajectoryFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TrajectoryFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.response_;
+}
+
+void TrajectoryFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TrajectoryFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.TrajectoryFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+  ::memset(&_impl_.c_real_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.frame_index_) -
+      reinterpret_cast<char*>(&_impl_.c_real_)) + sizeof(_impl_.frame_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrajectoryFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 frame_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.frame_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double c_real = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.c_real_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double c_imag = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.c_imag_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.JuliaResponse response = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TrajectoryFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.TrajectoryFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 frame_index = 1;
+  if (this->_internal_frame_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_frame_index(), target);
+  }
+
+  // double c_real = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_c_real = this->_internal_c_real();
+  uint64_t raw_c_real;
+  memcpy(&raw_c_real, &tmp_c_real, sizeof(tmp_c_real));
+  if (raw_c_real != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_c_real(), target);
+  }
+
+  // double c_imag = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_c_imag = this->_internal_c_imag();
+  uint64_t raw_c_imag;
+  memcpy(&raw_c_imag, &tmp_c_imag, sizeof(tmp_c_imag));
+  if (raw_c_imag != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_c_imag(), target);
+  }
+
+  // .fractal.JuliaResponse response = 4;
+  if (this->_internal_has_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.TrajectoryFrame)
+  return target;
+}
+
+size_t TrajectoryFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.TrajectoryFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .fractal.JuliaResponse response = 4;
+  if (this->_internal_has_response()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+  }
+
+  // double c_real = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_c_real = this->_internal_c_real();
+  uint64_t raw_c_real;
+  memcpy(&raw_c_real, &tmp_c_real, sizeof(tmp_c_real));
+  if (raw_c_real != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double c_imag = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_c_imag = this->_internal_c_imag();
+  uint64_t raw_c_imag;
+  memcpy(&raw_c_imag, &tmp_c_imag, sizeof(tmp_c_imag));
+  if (raw_c_imag != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 frame_index = 1;
+  if (this->_internal_frame_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_frame_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TrajectoryFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TrajectoryFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrajectoryFrame::GetClassData() const { return &_class_data_; }
+
+
+void TrajectoryFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TrajectoryFrame*>(&to_msg);
+  auto& from = static_cast<const TrajectoryFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.TrajectoryFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_response()) {
+    _this->_internal_mutable_response()->::fractal::JuliaResponse::MergeFrom(
+        from._internal_response());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_c_real = from._internal_c_real();
+  uint64_t raw_c_real;
+  memcpy(&raw_c_real, &tmp_c_real, sizeof(tmp_c_real));
+  if (raw_c_real != 0) {
+    _this->_internal_set_c_real(from._internal_c_real());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_c_imag = from._internal_c_imag();
+  uint64_t raw_c_imag;
+  memcpy(&raw_c_imag, &tmp_c_imag, sizeof(tmp_c_imag));
+  if (raw_c_imag != 0) {
+    _this->_internal_set_c_imag(from._internal_c_imag());
+  }
+  if (from._internal_frame_index() != 0) {
+    _this->_internal_set_frame_index(from._internal_frame_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TrajectoryFrame::CopyFrom(const TrajectoryFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.TrajectoryFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrajectoryFrame::IsInitialized() const {
+  return true;
+}
+
+void TrajectoryFrame::InternalSwap(TrajectoryFrame* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrajectoryFrame, _impl_.frame_index_)
+      + sizeof(TrajectoryFrame::_impl_.frame_index_)
+      - PROTOBUF_FIELD_OFFSET(TrajectoryFrame, _impl_.response_)>(
+          reinterpret_cast<char*>(&_impl_.response_),
+          reinterpret_cast<char*>(&other->_impl_.response_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrajectoryFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[7]);
+}
+
+// ===================================================================
+
+class SessionUpdate::_Internal {
+ public:
+  static const ::fractal::JuliaRequest& frame(const SessionUpdate* msg);
+};
+
+const ::fractal::JuliaRequest&
+SessionUpdate::_Internal::frame(const SessionUpdate* msg) {
+  return *msg->_impl_.frame_;
+}
+SessionUpdate::SessionUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.SessionUpdate)
+}
+SessionUpdate::SessionUpdate(const SessionUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){nullptr}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_frame()) {
+    _this->_impl_.frame_ = new ::fractal::JuliaRequest(*from._impl_.frame_);
+  }
+  _this->_impl_.sequence_ = from._impl_.sequence_;
+  // @@protoc_insertion_point(copy_constructor:fractal.SessionUpdate)
+}
+
+inline void SessionUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){nullptr}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SessionUpdate::~SessionUpdate() {
+  // @@protoc_insertion_point(destructor:fractal.SessionUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.frame_;
+}
+
+void SessionUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.SessionUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_ != nullptr) {
+    delete _impl_.frame_;
+  }
+  _impl_.frame_ = nullptr;
+  _impl_.sequence_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 sequence = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.JuliaRequest frame = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frame(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.SessionUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sequence(), target);
+  }
+
+  // .fractal.JuliaRequest frame = 2;
+  if (this->_internal_has_frame()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::frame(this),
+        _Internal::frame(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.SessionUpdate)
+  return target;
+}
+
+size_t SessionUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.SessionUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .fractal.JuliaRequest frame = 2;
+  if (this->_internal_has_frame()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.frame_);
+  }
+
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionUpdate::GetClassData() const { return &_class_data_; }
+
+
+void SessionUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionUpdate*>(&to_msg);
+  auto& from = static_cast<const SessionUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.SessionUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_frame()) {
+    _this->_internal_mutable_frame()->::fractal::JuliaRequest::MergeFrom(
+        from._internal_frame());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionUpdate::CopyFrom(const SessionUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.SessionUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionUpdate::IsInitialized() const {
+  return true;
+}
+
+void SessionUpdate::InternalSwap(SessionUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionUpdate, _impl_.sequence_)
+      + sizeof(SessionUpdate::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(SessionUpdate, _impl_.frame_)>(
+          reinterpret_cast<char*>(&_impl_.frame_),
+          reinterpret_cast<char*>(&other->_impl_.frame_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[8]);
+}
+
+// ===================================================================
+
+class SessionFrame::_Internal {
+ public:
+  static const ::fractal::JuliaResponse& response(const SessionFrame* msg);
+};
+
+const ::fractal::JuliaResponse&
+SessionFrame::_Internal::response(const SessionFrame* msg) {
+  return *msg->_impl_.response_;
+}
+SessionFrame::SessionFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.SessionFrame)
+}
+SessionFrame::SessionFrame(const SessionFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.dropped_updates_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_response()) {
+    _this->_impl_.response_ = new ::fractal::JuliaResponse(*from._impl_.response_);
+  }
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dropped_updates_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.dropped_updates_));
+  // @@protoc_insertion_point(copy_constructor:fractal.SessionFrame)
+}
+
+inline void SessionFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.dropped_updates_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SessionFrame::~SessionFrame() {
+  // @@protoc_insertion_point(destructor:fractal.SessionFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.response_;
+}
+
+void SessionFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.SessionFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+  ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dropped_updates_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.dropped_updates_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 sequence = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fractal.JuliaResponse response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 dropped_updates = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.dropped_updates_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.SessionFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sequence(), target);
+  }
+
+  // .fractal.JuliaResponse response = 2;
+  if (this->_internal_has_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 dropped_updates = 3;
+  if (this->_internal_dropped_updates() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_dropped_updates(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.SessionFrame)
+  return target;
+}
+
+size_t SessionFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.SessionFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .fractal.JuliaResponse response = 2;
+  if (this->_internal_has_response()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+  }
+
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  // uint32 dropped_updates = 3;
+  if (this->_internal_dropped_updates() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dropped_updates());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionFrame::GetClassData() const { return &_class_data_; }
+
+
+void SessionFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionFrame*>(&to_msg);
+  auto& from = static_cast<const SessionFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.SessionFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_response()) {
+    _this->_internal_mutable_response()->::fractal::JuliaResponse::MergeFrom(
+        from._internal_response());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_dropped_updates() != 0) {
+    _this->_internal_set_dropped_updates(from._internal_dropped_updates());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionFrame::CopyFrom(const SessionFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.SessionFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionFrame::IsInitialized() const {
+  return true;
+}
+
+void SessionFrame::InternalSwap(SessionFrame* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionFrame, _impl_.dropped_updates_)
+      + sizeof(SessionFrame::_impl_.dropped_updates_)
+      - PROTOBUF_FIELD_OFFSET(SessionFrame, _impl_.response_)>(
+          reinterpret_cast<char*>(&_impl_.response_),
+          reinterpret_cast<char*>(&other->_impl_.response_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[9]);
+}
+
+// ===================================================================
+
+class ServerStatsRequest::_Internal {
+ public:
+};
+
+ServerStatsRequest::ServerStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:fractal.ServerStatsRequest)
+}
+ServerStatsRequest::ServerStatsRequest(const ServerStatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  ServerStatsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:fractal.ServerStatsRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
+      file_level_metadata_fractal_2eproto[10]);
+}
+
+// ===================================================================
+
+class ServerStatsResponse::_Internal {
+ public:
+};
+
+ServerStatsResponse::ServerStatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fractal.ServerStatsResponse)
+}
+ServerStatsResponse::ServerStatsResponse(const ServerStatsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStatsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_id_){}
+    , decltype(_impl_.cache_hits_){}
+    , decltype(_impl_.cache_misses_){}
+    , decltype(_impl_.cache_entries_){}
+    , decltype(_impl_.cache_bytes_){}
+    , decltype(_impl_.cache_capacity_){}
+    , decltype(_impl_.cache_evictions_){}
+    , decltype(_impl_.coalesced_requests_){}
+    , decltype(_impl_.disk_hits_){}
+    , decltype(_impl_.disk_entries_){}
+    , decltype(_impl_.disk_bytes_){}
+    , decltype(_impl_.disk_capacity_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.server_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_server_id().empty()) {
+    _this->_impl_.server_id_.Set(from._internal_server_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cache_hits_, &from._impl_.cache_hits_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.disk_capacity_) -
+    reinterpret_cast<char*>(&_impl_.cache_hits_)) + sizeof(_impl_.disk_capacity_));
+  // @@protoc_insertion_point(copy_constructor:fractal.ServerStatsResponse)
+}
+
+inline void ServerStatsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_id_){}
+    , decltype(_impl_.cache_hits_){uint64_t{0u}}
+    , decltype(_impl_.cache_misses_){uint64_t{0u}}
+    , decltype(_impl_.cache_entries_){uint64_t{0u}}
+    , decltype(_impl_.cache_bytes_){uint64_t{0u}}
+    , decltype(_impl_.cache_capacity_){uint64_t{0u}}
+    , decltype(_impl_.cache_evictions_){uint64_t{0u}}
+    , decltype(_impl_.coalesced_requests_){uint64_t{0u}}
+    , decltype(_impl_.disk_hits_){uint64_t{0u}}
+    , decltype(_impl_.disk_entries_){uint64_t{0u}}
+    , decltype(_impl_.disk_bytes_){uint64_t{0u}}
+    , decltype(_impl_.disk_capacity_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.server_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerStatsResponse::~ServerStatsResponse() {
+  // @@protoc_insertion_point(destructor:fractal.ServerStatsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStatsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.server_id_.Destroy();
+}
+
+void ServerStatsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStatsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fractal.ServerStatsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_id_.ClearToEmpty();
+  ::memset(&_impl_.cache_hits_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.disk_capacity_) -
+      reinterpret_cast<char*>(&_impl_.cache_hits_)) + sizeof(_impl_.disk_capacity_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStatsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string server_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_server_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fractal.ServerStatsResponse.server_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_hits = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cache_hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_misses = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cache_misses_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_entries = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.cache_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_bytes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.cache_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_capacity = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.cache_capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_evictions = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.cache_evictions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 coalesced_requests = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.coalesced_requests_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 disk_hits = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.disk_hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 disk_entries = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.disk_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 disk_bytes = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.disk_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 disk_capacity = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.disk_capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStatsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fractal.ServerStatsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string server_id = 1;
+  if (!this->_internal_server_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_server_id().data(), static_cast<int>(this->_internal_server_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fractal.ServerStatsResponse.server_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_server_id(), target);
+  }
+
+  // uint64 cache_hits = 2;
+  if (this->_internal_cache_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_cache_hits(), target);
+  }
+
+  // uint64 cache_misses = 3;
+  if (this->_internal_cache_misses() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_cache_misses(), target);
+  }
+
+  // uint64 cache_entries = 4;
+  if (this->_internal_cache_entries() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_cache_entries(), target);
+  }
+
+  // uint64 cache_bytes = 5;
+  if (this->_internal_cache_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_cache_bytes(), target);
+  }
+
+  // uint64 cache_capacity = 6;
+  if (this->_internal_cache_capacity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_cache_capacity(), target);
+  }
+
+  // uint64 cache_evictions = 7;
+  if (this->_internal_cache_evictions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_cache_evictions(), target);
+  }
+
+  // uint64 coalesced_requests = 8;
+  if (this->_internal_coalesced_requests() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_coalesced_requests(), target);
+  }
+
+  // uint64 disk_hits = 9;
+  if (this->_internal_disk_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_disk_hits(), target);
+  }
+
+  // uint64 disk_entries = 10;
+  if (this->_internal_disk_entries() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_disk_entries(), target);
+  }
+
+  // uint64 disk_bytes = 11;
+  if (this->_internal_disk_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_disk_bytes(), target);
+  }
+
+  // uint64 disk_capacity = 12;
+  if (this->_internal_disk_capacity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_disk_capacity(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fractal.JuliaResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fractal.ServerStatsResponse)
   return target;
 }
 
-size_t JuliaResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fractal.JuliaResponse)
+size_t ServerStatsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fractal.ServerStatsResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes rgba_data = 1;
-  if (!this->_internal_rgba_data().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_rgba_data());
-  }
-
-  // string server_id = 3;
+  // string server_id = 1;
   if (!this->_internal_server_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_server_id());
   }
 
-  // double calculation_time_ms = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_calculation_time_ms = this->_internal_calculation_time_ms();
-  uint64_t raw_calculation_time_ms;
-  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
-  if (raw_calculation_time_ms != 0) {
-    total_size += 1 + 8;
+  // uint64 cache_hits = 2;
+  if (this->_internal_cache_hits() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_hits());
+  }
+
+  // uint64 cache_misses = 3;
+  if (this->_internal_cache_misses() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_misses());
+  }
+
+  // uint64 cache_entries = 4;
+  if (this->_internal_cache_entries() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_entries());
+  }
+
+  // uint64 cache_bytes = 5;
+  if (this->_internal_cache_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_bytes());
+  }
+
+  // uint64 cache_capacity = 6;
+  if (this->_internal_cache_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_capacity());
+  }
+
+  // uint64 cache_evictions = 7;
+  if (this->_internal_cache_evictions() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_evictions());
+  }
+
+  // uint64 coalesced_requests = 8;
+  if (this->_internal_coalesced_requests() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_coalesced_requests());
+  }
+
+  // uint64 disk_hits = 9;
+  if (this->_internal_disk_hits() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_disk_hits());
+  }
+
+  // uint64 disk_entries = 10;
+  if (this->_internal_disk_entries() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_disk_entries());
+  }
+
+  // uint64 disk_bytes = 11;
+  if (this->_internal_disk_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_disk_bytes());
+  }
+
+  // uint64 disk_capacity = 12;
+  if (this->_internal_disk_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_disk_capacity());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JuliaResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatsResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    JuliaResponse::MergeImpl
+    ServerStatsResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JuliaResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatsResponse::GetClassData() const { return &_class_data_; }
 
 
-void JuliaResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<JuliaResponse*>(&to_msg);
-  auto& from = static_cast<const JuliaResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.JuliaResponse)
+void ServerStatsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStatsResponse*>(&to_msg);
+  auto& from = static_cast<const ServerStatsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fractal.ServerStatsResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_rgba_data().empty()) {
-    _this->_internal_set_rgba_data(from._internal_rgba_data());
-  }
   if (!from._internal_server_id().empty()) {
     _this->_internal_set_server_id(from._internal_server_id());
   }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_calculation_time_ms = from._internal_calculation_time_ms();
-  uint64_t raw_calculation_time_ms;
-  memcpy(&raw_calculation_time_ms, &tmp_calculation_time_ms, sizeof(tmp_calculation_time_ms));
-  if (raw_calculation_time_ms != 0) {
-    _this->_internal_set_calculation_time_ms(from._internal_calculation_time_ms());
+  if (from._internal_cache_hits() != 0) {
+    _this->_internal_set_cache_hits(from._internal_cache_hits());
+  }
+  if (from._internal_cache_misses() != 0) {
+    _this->_internal_set_cache_misses(from._internal_cache_misses());
+  }
+  if (from._internal_cache_entries() != 0) {
+    _this->_internal_set_cache_entries(from._internal_cache_entries());
+  }
+  if (from._internal_cache_bytes() != 0) {
+    _this->_internal_set_cache_bytes(from._internal_cache_bytes());
+  }
+  if (from._internal_cache_capacity() != 0) {
+    _this->_internal_set_cache_capacity(from._internal_cache_capacity());
+  }
+  if (from._internal_cache_evictions() != 0) {
+    _this->_internal_set_cache_evictions(from._internal_cache_evictions());
+  }
+  if (from._internal_coalesced_requests() != 0) {
+    _this->_internal_set_coalesced_requests(from._internal_coalesced_requests());
+  }
+  if (from._internal_disk_hits() != 0) {
+    _this->_internal_set_disk_hits(from._internal_disk_hits());
+  }
+  if (from._internal_disk_entries() != 0) {
+    _this->_internal_set_disk_entries(from._internal_disk_entries());
+  }
+  if (from._internal_disk_bytes() != 0) {
+    _this->_internal_set_disk_bytes(from._internal_disk_bytes());
+  }
+  if (from._internal_disk_capacity() != 0) {
+    _this->_internal_set_disk_capacity(from._internal_disk_capacity());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void JuliaResponse::CopyFrom(const JuliaResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fractal.JuliaResponse)
+void ServerStatsResponse::CopyFrom(const ServerStatsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fractal.ServerStatsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool JuliaResponse::IsInitialized() const {
+bool ServerStatsResponse::IsInitialized() const {
   return true;
 }
 
-void JuliaResponse::InternalSwap(JuliaResponse* other) {
+void ServerStatsResponse::InternalSwap(ServerStatsResponse* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.rgba_data_, lhs_arena,
-      &other->_impl_.rgba_data_, rhs_arena
-  );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.server_id_, lhs_arena,
       &other->_impl_.server_id_, rhs_arena
   );
-  swap(_impl_.calculation_time_ms_, other->_impl_.calculation_time_ms_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStatsResponse, _impl_.disk_capacity_)
+      + sizeof(ServerStatsResponse::_impl_.disk_capacity_)
+      - PROTOBUF_FIELD_OFFSET(ServerStatsResponse, _impl_.cache_hits_)>(
+          reinterpret_cast<char*>(&_impl_.cache_hits_),
+          reinterpret_cast<char*>(&other->_impl_.cache_hits_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata JuliaResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
-      file_level_metadata_fractal_2eproto[1]);
+      file_level_metadata_fractal_2eproto[11]);
 }
 
 // ===================================================================
@@ -972,7 +4394,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ShutdownRequest::GetClassData(
 ::PROTOBUF_NAMESPACE_ID::Metadata ShutdownRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
-      file_level_metadata_fractal_2eproto[2]);
+      file_level_metadata_fractal_2eproto[12]);
 }
 
 // ===================================================================
@@ -1175,7 +4597,7 @@ void ShutdownResponse::InternalSwap(ShutdownResponse* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ShutdownResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fractal_2eproto_getter, &descriptor_table_fractal_2eproto_once,
-      file_level_metadata_fractal_2eproto[3]);
+      file_level_metadata_fractal_2eproto[13]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1185,10 +4607,50 @@ template<> PROTOBUF_NOINLINE ::fractal::JuliaRequest*
 Arena::CreateMaybeMessage< ::fractal::JuliaRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::fractal::JuliaRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::fractal::SharedFrame*
+Arena::CreateMaybeMessage< ::fractal::SharedFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::SharedFrame >(arena);
+}
 template<> PROTOBUF_NOINLINE ::fractal::JuliaResponse*
 Arena::CreateMaybeMessage< ::fractal::JuliaResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::fractal::JuliaResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::fractal::JuliaBatchRequest*
+Arena::CreateMaybeMessage< ::fractal::JuliaBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::JuliaBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::JuliaBatchResponse*
+Arena::CreateMaybeMessage< ::fractal::JuliaBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::JuliaBatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::FrameChunk*
+Arena::CreateMaybeMessage< ::fractal::FrameChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::FrameChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::TrajectoryRequest*
+Arena::CreateMaybeMessage< ::fractal::TrajectoryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::TrajectoryRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::TrajectoryFrame*
+Arena::CreateMaybeMessage< ::fractal::TrajectoryFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::TrajectoryFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::SessionUpdate*
+Arena::CreateMaybeMessage< ::fractal::SessionUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::SessionUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::SessionFrame*
+Arena::CreateMaybeMessage< ::fractal::SessionFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::SessionFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::ServerStatsRequest*
+Arena::CreateMaybeMessage< ::fractal::ServerStatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::ServerStatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fractal::ServerStatsResponse*
+Arena::CreateMaybeMessage< ::fractal::ServerStatsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fractal::ServerStatsResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::fractal::ShutdownRequest*
 Arena::CreateMaybeMessage< ::fractal::ShutdownRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::fractal::ShutdownRequest >(arena);
@@ -30,6 +30,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -46,27 +47,120 @@ struct TableStruct_fractal_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_fractal_2eproto;
 namespace fractal {
+class FrameChunk;
+struct FrameChunkDefaultTypeInternal;
+extern FrameChunkDefaultTypeInternal _FrameChunk_default_instance_;
+class JuliaBatchRequest;
+struct JuliaBatchRequestDefaultTypeInternal;
+extern JuliaBatchRequestDefaultTypeInternal _JuliaBatchRequest_default_instance_;
+class JuliaBatchResponse;
+struct JuliaBatchResponseDefaultTypeInternal;
+extern JuliaBatchResponseDefaultTypeInternal _JuliaBatchResponse_default_instance_;
 class JuliaRequest;
 struct JuliaRequestDefaultTypeInternal;
 extern JuliaRequestDefaultTypeInternal _JuliaRequest_default_instance_;
 class JuliaResponse;
 struct JuliaResponseDefaultTypeInternal;
 extern JuliaResponseDefaultTypeInternal _JuliaResponse_default_instance_;
+class ServerStatsRequest;
+struct ServerStatsRequestDefaultTypeInternal;
+extern ServerStatsRequestDefaultTypeInternal _ServerStatsRequest_default_instance_;
+class ServerStatsResponse;
+struct ServerStatsResponseDefaultTypeInternal;
+extern ServerStatsResponseDefaultTypeInternal _ServerStatsResponse_default_instance_;
+class SessionFrame;
+struct SessionFrameDefaultTypeInternal;
+extern SessionFrameDefaultTypeInternal _SessionFrame_default_instance_;
+class SessionUpdate;
+struct SessionUpdateDefaultTypeInternal;
+extern SessionUpdateDefaultTypeInternal _SessionUpdate_default_instance_;
+class SharedFrame;
+struct SharedFrameDefaultTypeInternal;
+extern SharedFrameDefaultTypeInternal _SharedFrame_default_instance_;
 class ShutdownRequest;
 struct ShutdownRequestDefaultTypeInternal;
 extern ShutdownRequestDefaultTypeInternal _ShutdownRequest_default_instance_;
 class ShutdownResponse;
 struct ShutdownResponseDefaultTypeInternal;
 extern ShutdownResponseDefaultTypeInternal _ShutdownResponse_default_instance_;
+class TrajectoryFrame;
+struct TrajectoryFrameDefaultTypeInternal;
+extern TrajectoryFrameDefaultTypeInternal _TrajectoryFrame_default_instance_;
+class TrajectoryRequest;
+struct TrajectoryRequestDefaultTypeInternal;
+extern TrajectoryRequestDefaultTypeInternal _TrajectoryRequest_default_instance_;
 }  // namespace fractal
 PROTOBUF_NAMESPACE_OPEN
+template<> ::fractal::FrameChunk* Arena::CreateMaybeMessage<::fractal::FrameChunk>(Arena*);
+template<> ::fractal::JuliaBatchRequest* Arena::CreateMaybeMessage<::fractal::JuliaBatchRequest>(Arena*);
+template<> ::fractal::JuliaBatchResponse* Arena::CreateMaybeMessage<::fractal::JuliaBatchResponse>(Arena*);
 template<> ::fractal::JuliaRequest* Arena::CreateMaybeMessage<::fractal::JuliaRequest>(Arena*);
 template<> ::fractal::JuliaResponse* Arena::CreateMaybeMessage<::fractal::JuliaResponse>(Arena*);
+template<> ::fractal::ServerStatsRequest* Arena::CreateMaybeMessage<::fractal::ServerStatsRequest>(Arena*);
+template<> ::fractal::ServerStatsResponse* Arena::CreateMaybeMessage<::fractal::ServerStatsResponse>(Arena*);
+template<> ::fractal::SessionFrame* Arena::CreateMaybeMessage<::fractal::SessionFrame>(Arena*);
+template<> ::fractal::SessionUpdate* Arena::CreateMaybeMessage<::fractal::SessionUpdate>(Arena*);
+template<> ::fractal::SharedFrame* Arena::CreateMaybeMessage<::fractal::SharedFrame>(Arena*);
 template<> ::fractal::ShutdownRequest* Arena::CreateMaybeMessage<::fractal::ShutdownRequest>(Arena*);
 template<> ::fractal::ShutdownResponse* Arena::CreateMaybeMessage<::fractal::ShutdownResponse>(Arena*);
+template<> ::fractal::TrajectoryFrame* Arena::CreateMaybeMessage<::fractal::TrajectoryFrame>(Arena*);
+template<> ::fractal::TrajectoryRequest* Arena::CreateMaybeMessage<::fractal::TrajectoryRequest>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace fractal {
 
+enum FrameEncoding : int {
+  RAW = 0,
+  QOI = 1,
+  DEFLATE = 2,
+  XRLE = 3,
+  FrameEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  FrameEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool FrameEncoding_IsValid(int value);
+constexpr FrameEncoding FrameEncoding_MIN = RAW;
+constexpr FrameEncoding FrameEncoding_MAX = XRLE;
+constexpr int FrameEncoding_ARRAYSIZE = FrameEncoding_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FrameEncoding_descriptor();
+template<typename T>
+inline const std::string& FrameEncoding_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FrameEncoding>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FrameEncoding_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FrameEncoding_descriptor(), enum_t_value);
+}
+inline bool FrameEncoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FrameEncoding* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FrameEncoding>(
+    FrameEncoding_descriptor(), name, value);
+}
+enum PixelFormat : int {
+  RGBA8 = 0,
+  PALETTE8 = 1,
+  ITER16 = 2,
+  PixelFormat_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PixelFormat_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PixelFormat_IsValid(int value);
+constexpr PixelFormat PixelFormat_MIN = RGBA8;
+constexpr PixelFormat PixelFormat_MAX = ITER16;
+constexpr int PixelFormat_ARRAYSIZE = PixelFormat_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PixelFormat_descriptor();
+template<typename T>
+inline const std::string& PixelFormat_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PixelFormat>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PixelFormat_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PixelFormat_descriptor(), enum_t_value);
+}
+inline bool PixelFormat_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PixelFormat* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PixelFormat>(
+    PixelFormat_descriptor(), name, value);
+}
 // ===================================================================
 
 class JuliaRequest final :
@@ -200,6 +294,11 @@ class JuliaRequest final :
     kXMaxFieldNumber = 8,
     kYMinFieldNumber = 9,
     kYMaxFieldNumber = 10,
+    kEncodingFieldNumber = 11,
+    kFormatFieldNumber = 12,
+    kThemeFieldNumber = 13,
+    kProgressiveFieldNumber = 14,
+    kSharedMemoryFieldNumber = 15,
   };
   // double c_real = 1;
   void clear_c_real();
@@ -291,6 +390,51 @@ class JuliaRequest final :
   void _internal_set_y_max(double value);
   public:
 
+  // .fractal.FrameEncoding encoding = 11;
+  void clear_encoding();
+  ::fractal::FrameEncoding encoding() const;
+  void set_encoding(::fractal::FrameEncoding value);
+  private:
+  ::fractal::FrameEncoding _internal_encoding() const;
+  void _internal_set_encoding(::fractal::FrameEncoding value);
+  public:
+
+  // .fractal.PixelFormat format = 12;
+  void clear_format();
+  ::fractal::PixelFormat format() const;
+  void set_format(::fractal::PixelFormat value);
+  private:
+  ::fractal::PixelFormat _internal_format() const;
+  void _internal_set_format(::fractal::PixelFormat value);
+  public:
+
+  // int32 theme = 13;
+  void clear_theme();
+  int32_t theme() const;
+  void set_theme(int32_t value);
+  private:
+  int32_t _internal_theme() const;
+  void _internal_set_theme(int32_t value);
+  public:
+
+  // bool progressive = 14;
+  void clear_progressive();
+  bool progressive() const;
+  void set_progressive(bool value);
+  private:
+  bool _internal_progressive() const;
+  void _internal_set_progressive(bool value);
+  public:
+
+  // bool shared_memory = 15;
+  void clear_shared_memory();
+  bool shared_memory() const;
+  void set_shared_memory(bool value);
+  private:
+  bool _internal_shared_memory() const;
+  void _internal_set_shared_memory(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:fractal.JuliaRequest)
  private:
   class _Internal;
@@ -309,6 +453,197 @@ class JuliaRequest final :
     double x_max_;
     double y_min_;
     double y_max_;
+    int encoding_;
+    int format_;
+    int32_t theme_;
+    bool progressive_;
+    bool shared_memory_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SharedFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.SharedFrame) */ {
+ public:
+  inline SharedFrame() : SharedFrame(nullptr) {}
+  ~SharedFrame() override;
+  explicit PROTOBUF_CONSTEXPR SharedFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SharedFrame(const SharedFrame& from);
+  SharedFrame(SharedFrame&& from) noexcept
+    : SharedFrame() {
+    *this = ::std::move(from);
+  }
+
+  inline SharedFrame& operator=(const SharedFrame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SharedFrame& operator=(SharedFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SharedFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SharedFrame* internal_default_instance() {
+    return reinterpret_cast<const SharedFrame*>(
+               &_SharedFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SharedFrame& a, SharedFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SharedFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SharedFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SharedFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SharedFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SharedFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SharedFrame& from) {
+    SharedFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SharedFrame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.SharedFrame";
+  }
+  protected:
+  explicit SharedFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kInstanceFieldNumber = 2,
+    kPositionFieldNumber = 3,
+    kSizeFieldNumber = 4,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 instance = 2;
+  void clear_instance();
+  uint64_t instance() const;
+  void set_instance(uint64_t value);
+  private:
+  uint64_t _internal_instance() const;
+  void _internal_set_instance(uint64_t value);
+  public:
+
+  // uint64 position = 3;
+  void clear_position();
+  uint64_t position() const;
+  void set_position(uint64_t value);
+  private:
+  uint64_t _internal_position() const;
+  void _internal_set_position(uint64_t value);
+  public:
+
+  // uint64 size = 4;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.SharedFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t instance_;
+    uint64_t position_;
+    uint64_t size_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -364,7 +699,7 @@ class JuliaResponse final :
                &_JuliaResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(JuliaResponse& a, JuliaResponse& b) {
     a.Swap(&b);
@@ -439,7 +774,12 @@ class JuliaResponse final :
   enum : int {
     kRgbaDataFieldNumber = 1,
     kServerIdFieldNumber = 3,
+    kSharedFieldNumber = 8,
     kCalculationTimeMsFieldNumber = 2,
+    kEncodingFieldNumber = 4,
+    kFormatFieldNumber = 5,
+    kScaleFieldNumber = 6,
+    kDeltaFieldNumber = 7,
   };
   // bytes rgba_data = 1;
   void clear_rgba_data();
@@ -469,6 +809,24 @@ class JuliaResponse final :
   std::string* _internal_mutable_server_id();
   public:
 
+  // .fractal.SharedFrame shared = 8;
+  bool has_shared() const;
+  private:
+  bool _internal_has_shared() const;
+  public:
+  void clear_shared();
+  const ::fractal::SharedFrame& shared() const;
+  PROTOBUF_NODISCARD ::fractal::SharedFrame* release_shared();
+  ::fractal::SharedFrame* mutable_shared();
+  void set_allocated_shared(::fractal::SharedFrame* shared);
+  private:
+  const ::fractal::SharedFrame& _internal_shared() const;
+  ::fractal::SharedFrame* _internal_mutable_shared();
+  public:
+  void unsafe_arena_set_allocated_shared(
+      ::fractal::SharedFrame* shared);
+  ::fractal::SharedFrame* unsafe_arena_release_shared();
+
   // double calculation_time_ms = 2;
   void clear_calculation_time_ms();
   double calculation_time_ms() const;
@@ -478,6 +836,42 @@ class JuliaResponse final :
   void _internal_set_calculation_time_ms(double value);
   public:
 
+  // .fractal.FrameEncoding encoding = 4;
+  void clear_encoding();
+  ::fractal::FrameEncoding encoding() const;
+  void set_encoding(::fractal::FrameEncoding value);
+  private:
+  ::fractal::FrameEncoding _internal_encoding() const;
+  void _internal_set_encoding(::fractal::FrameEncoding value);
+  public:
+
+  // .fractal.PixelFormat format = 5;
+  void clear_format();
+  ::fractal::PixelFormat format() const;
+  void set_format(::fractal::PixelFormat value);
+  private:
+  ::fractal::PixelFormat _internal_format() const;
+  void _internal_set_format(::fractal::PixelFormat value);
+  public:
+
+  // int32 scale = 6;
+  void clear_scale();
+  int32_t scale() const;
+  void set_scale(int32_t value);
+  private:
+  int32_t _internal_scale() const;
+  void _internal_set_scale(int32_t value);
+  public:
+
+  // bool delta = 7;
+  void clear_delta();
+  bool delta() const;
+  void set_delta(bool value);
+  private:
+  bool _internal_delta() const;
+  void _internal_set_delta(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:fractal.JuliaResponse)
  private:
   class _Internal;
@@ -488,7 +882,12 @@ class JuliaResponse final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rgba_data_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_id_;
+    ::fractal::SharedFrame* shared_;
     double calculation_time_ms_;
+    int encoding_;
+    int format_;
+    int32_t scale_;
+    bool delta_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -496,23 +895,24 @@ class JuliaResponse final :
 };
 // -------------------------------------------------------------------
 
-class ShutdownRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:fractal.ShutdownRequest) */ {
+class JuliaBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.JuliaBatchRequest) */ {
  public:
-  inline ShutdownRequest() : ShutdownRequest(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR ShutdownRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline JuliaBatchRequest() : JuliaBatchRequest(nullptr) {}
+  ~JuliaBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR JuliaBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ShutdownRequest(const ShutdownRequest& from);
-  ShutdownRequest(ShutdownRequest&& from) noexcept
-    : ShutdownRequest() {
+  JuliaBatchRequest(const JuliaBatchRequest& from);
+  JuliaBatchRequest(JuliaBatchRequest&& from) noexcept
+    : JuliaBatchRequest() {
     *this = ::std::move(from);
   }
 
-  inline ShutdownRequest& operator=(const ShutdownRequest& from) {
+  inline JuliaBatchRequest& operator=(const JuliaBatchRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ShutdownRequest& operator=(ShutdownRequest&& from) noexcept {
+  inline JuliaBatchRequest& operator=(JuliaBatchRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -535,20 +935,20 @@ class ShutdownRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ShutdownRequest& default_instance() {
+  static const JuliaBatchRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ShutdownRequest* internal_default_instance() {
-    return reinterpret_cast<const ShutdownRequest*>(
-               &_ShutdownRequest_default_instance_);
+  static inline const JuliaBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const JuliaBatchRequest*>(
+               &_JuliaBatchRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
-  friend void swap(ShutdownRequest& a, ShutdownRequest& b) {
+  friend void swap(JuliaBatchRequest& a, JuliaBatchRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ShutdownRequest* other) {
+  inline void Swap(JuliaBatchRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -561,7 +961,7 @@ class ShutdownRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ShutdownRequest* other) {
+  void UnsafeArenaSwap(JuliaBatchRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -569,26 +969,40 @@ class ShutdownRequest final :
 
   // implements Message ----------------------------------------------
 
-  ShutdownRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ShutdownRequest>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const ShutdownRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  JuliaBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JuliaBatchRequest>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const ShutdownRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JuliaBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JuliaBatchRequest& from) {
+    JuliaBatchRequest::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(JuliaBatchRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fractal.ShutdownRequest";
+    return "fractal.JuliaBatchRequest";
   }
   protected:
-  explicit ShutdownRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit JuliaBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -601,7 +1015,28 @@ class ShutdownRequest final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:fractal.ShutdownRequest)
+  enum : int {
+    kRequestsFieldNumber = 1,
+  };
+  // repeated .fractal.JuliaRequest requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::fractal::JuliaRequest* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fractal::JuliaRequest >*
+      mutable_requests();
+  private:
+  const ::fractal::JuliaRequest& _internal_requests(int index) const;
+  ::fractal::JuliaRequest* _internal_add_requests();
+  public:
+  const ::fractal::JuliaRequest& requests(int index) const;
+  ::fractal::JuliaRequest* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fractal::JuliaRequest >&
+      requests() const;
+
+  // @@protoc_insertion_point(class_scope:fractal.JuliaBatchRequest)
  private:
   class _Internal;
 
@@ -609,29 +1044,32 @@ class ShutdownRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fractal::JuliaRequest > requests_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_fractal_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ShutdownResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.ShutdownResponse) */ {
+class JuliaBatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.JuliaBatchResponse) */ {
  public:
-  inline ShutdownResponse() : ShutdownResponse(nullptr) {}
-  ~ShutdownResponse() override;
-  explicit PROTOBUF_CONSTEXPR ShutdownResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline JuliaBatchResponse() : JuliaBatchResponse(nullptr) {}
+  ~JuliaBatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR JuliaBatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ShutdownResponse(const ShutdownResponse& from);
-  ShutdownResponse(ShutdownResponse&& from) noexcept
-    : ShutdownResponse() {
+  JuliaBatchResponse(const JuliaBatchResponse& from);
+  JuliaBatchResponse(JuliaBatchResponse&& from) noexcept
+    : JuliaBatchResponse() {
     *this = ::std::move(from);
   }
 
-  inline ShutdownResponse& operator=(const ShutdownResponse& from) {
+  inline JuliaBatchResponse& operator=(const JuliaBatchResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ShutdownResponse& operator=(ShutdownResponse&& from) noexcept {
+  inline JuliaBatchResponse& operator=(JuliaBatchResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -654,20 +1092,20 @@ class ShutdownResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ShutdownResponse& default_instance() {
+  static const JuliaBatchResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ShutdownResponse* internal_default_instance() {
-    return reinterpret_cast<const ShutdownResponse*>(
-               &_ShutdownResponse_default_instance_);
+  static inline const JuliaBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const JuliaBatchResponse*>(
+               &_JuliaBatchResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
-  friend void swap(ShutdownResponse& a, ShutdownResponse& b) {
+  friend void swap(JuliaBatchResponse& a, JuliaBatchResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(ShutdownResponse* other) {
+  inline void Swap(JuliaBatchResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -680,7 +1118,7 @@ class ShutdownResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ShutdownResponse* other) {
+  void UnsafeArenaSwap(JuliaBatchResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -688,14 +1126,14 @@ class ShutdownResponse final :
 
   // implements Message ----------------------------------------------
 
-  ShutdownResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ShutdownResponse>(arena);
+  JuliaBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JuliaBatchResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ShutdownResponse& from);
+  void CopyFrom(const JuliaBatchResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ShutdownResponse& from) {
-    ShutdownResponse::MergeImpl(*this, from);
+  void MergeFrom( const JuliaBatchResponse& from) {
+    JuliaBatchResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -713,15 +1151,15 @@ class ShutdownResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ShutdownResponse* other);
+  void InternalSwap(JuliaBatchResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fractal.ShutdownResponse";
+    return "fractal.JuliaBatchResponse";
   }
   protected:
-  explicit ShutdownResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit JuliaBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -735,357 +1173,3439 @@ class ShutdownResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 1,
+    kResponseFieldNumber = 2,
+    kIndexFieldNumber = 1,
   };
-  // string message = 1;
-  void clear_message();
-  const std::string& message() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* message);
+  // .fractal.JuliaResponse response = 2;
+  bool has_response() const;
   private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
-  std::string* _internal_mutable_message();
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::fractal::JuliaResponse& response() const;
+  PROTOBUF_NODISCARD ::fractal::JuliaResponse* release_response();
+  ::fractal::JuliaResponse* mutable_response();
+  void set_allocated_response(::fractal::JuliaResponse* response);
+  private:
+  const ::fractal::JuliaResponse& _internal_response() const;
+  ::fractal::JuliaResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::fractal::JuliaResponse* response);
+  ::fractal::JuliaResponse* unsafe_arena_release_response();
+
+  // int32 index = 1;
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
+  private:
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.JuliaBatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fractal::JuliaResponse* response_;
+    int32_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FrameChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.FrameChunk) */ {
+ public:
+  inline FrameChunk() : FrameChunk(nullptr) {}
+  ~FrameChunk() override;
+  explicit PROTOBUF_CONSTEXPR FrameChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FrameChunk(const FrameChunk& from);
+  FrameChunk(FrameChunk&& from) noexcept
+    : FrameChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline FrameChunk& operator=(const FrameChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FrameChunk& operator=(FrameChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FrameChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameChunk* internal_default_instance() {
+    return reinterpret_cast<const FrameChunk*>(
+               &_FrameChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(FrameChunk& a, FrameChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FrameChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrameChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FrameChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FrameChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrameChunk& from) {
+    FrameChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FrameChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.FrameChunk";
+  }
+  protected:
+  explicit FrameChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kServerIdFieldNumber = 7,
+    kFirstRowFieldNumber = 1,
+    kRowsFieldNumber = 2,
+    kEncodingFieldNumber = 4,
+    kFormatFieldNumber = 5,
+    kCalculationTimeMsFieldNumber = 6,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // string server_id = 7;
+  void clear_server_id();
+  const std::string& server_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server_id();
+  PROTOBUF_NODISCARD std::string* release_server_id();
+  void set_allocated_server_id(std::string* server_id);
+  private:
+  const std::string& _internal_server_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_id(const std::string& value);
+  std::string* _internal_mutable_server_id();
+  public:
+
+  // int32 first_row = 1;
+  void clear_first_row();
+  int32_t first_row() const;
+  void set_first_row(int32_t value);
+  private:
+  int32_t _internal_first_row() const;
+  void _internal_set_first_row(int32_t value);
+  public:
+
+  // int32 rows = 2;
+  void clear_rows();
+  int32_t rows() const;
+  void set_rows(int32_t value);
+  private:
+  int32_t _internal_rows() const;
+  void _internal_set_rows(int32_t value);
+  public:
+
+  // .fractal.FrameEncoding encoding = 4;
+  void clear_encoding();
+  ::fractal::FrameEncoding encoding() const;
+  void set_encoding(::fractal::FrameEncoding value);
+  private:
+  ::fractal::FrameEncoding _internal_encoding() const;
+  void _internal_set_encoding(::fractal::FrameEncoding value);
+  public:
+
+  // .fractal.PixelFormat format = 5;
+  void clear_format();
+  ::fractal::PixelFormat format() const;
+  void set_format(::fractal::PixelFormat value);
+  private:
+  ::fractal::PixelFormat _internal_format() const;
+  void _internal_set_format(::fractal::PixelFormat value);
+  public:
+
+  // double calculation_time_ms = 6;
+  void clear_calculation_time_ms();
+  double calculation_time_ms() const;
+  void set_calculation_time_ms(double value);
+  private:
+  double _internal_calculation_time_ms() const;
+  void _internal_set_calculation_time_ms(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.FrameChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_id_;
+    int32_t first_row_;
+    int32_t rows_;
+    int encoding_;
+    int format_;
+    double calculation_time_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrajectoryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.TrajectoryRequest) */ {
+ public:
+  inline TrajectoryRequest() : TrajectoryRequest(nullptr) {}
+  ~TrajectoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR TrajectoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TrajectoryRequest(const TrajectoryRequest& from);
+  TrajectoryRequest(TrajectoryRequest&& from) noexcept
+    : TrajectoryRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TrajectoryRequest& operator=(const TrajectoryRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrajectoryRequest& operator=(TrajectoryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrajectoryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrajectoryRequest* internal_default_instance() {
+    return reinterpret_cast<const TrajectoryRequest*>(
+               &_TrajectoryRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(TrajectoryRequest& a, TrajectoryRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrajectoryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrajectoryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TrajectoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrajectoryRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrajectoryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrajectoryRequest& from) {
+    TrajectoryRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrajectoryRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.TrajectoryRequest";
+  }
+  protected:
+  explicit TrajectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrameFieldNumber = 1,
+    kStepRealFieldNumber = 2,
+    kStepImagFieldNumber = 3,
+    kFrameCountFieldNumber = 4,
+    kFirstFrameFieldNumber = 5,
+    kLookaheadFieldNumber = 6,
+    kKeyframeIntervalFieldNumber = 7,
+  };
+  // .fractal.JuliaRequest frame = 1;
+  bool has_frame() const;
+  private:
+  bool _internal_has_frame() const;
+  public:
+  void clear_frame();
+  const ::fractal::JuliaRequest& frame() const;
+  PROTOBUF_NODISCARD ::fractal::JuliaRequest* release_frame();
+  ::fractal::JuliaRequest* mutable_frame();
+  void set_allocated_frame(::fractal::JuliaRequest* frame);
+  private:
+  const ::fractal::JuliaRequest& _internal_frame() const;
+  ::fractal::JuliaRequest* _internal_mutable_frame();
+  public:
+  void unsafe_arena_set_allocated_frame(
+      ::fractal::JuliaRequest* frame);
+  ::fractal::JuliaRequest* unsafe_arena_release_frame();
+
+  // double step_real = 2;
+  void clear_step_real();
+  double step_real() const;
+  void set_step_real(double value);
+  private:
+  double _internal_step_real() const;
+  void _internal_set_step_real(double value);
+  public:
+
+  // double step_imag = 3;
+  void clear_step_imag();
+  double step_imag() const;
+  void set_step_imag(double value);
+  private:
+  double _internal_step_imag() const;
+  void _internal_set_step_imag(double value);
+  public:
+
+  // int32 frame_count = 4;
+  void clear_frame_count();
+  int32_t frame_count() const;
+  void set_frame_count(int32_t value);
+  private:
+  int32_t _internal_frame_count() const;
+  void _internal_set_frame_count(int32_t value);
+  public:
+
+  // int32 first_frame = 5;
+  void clear_first_frame();
+  int32_t first_frame() const;
+  void set_first_frame(int32_t value);
+  private:
+  int32_t _internal_first_frame() const;
+  void _internal_set_first_frame(int32_t value);
+  public:
+
+  // int32 lookahead = 6;
+  void clear_lookahead();
+  int32_t lookahead() const;
+  void set_lookahead(int32_t value);
+  private:
+  int32_t _internal_lookahead() const;
+  void _internal_set_lookahead(int32_t value);
+  public:
+
+  // int32 keyframe_interval = 7;
+  void clear_keyframe_interval();
+  int32_t keyframe_interval() const;
+  void set_keyframe_interval(int32_t value);
+  private:
+  int32_t _internal_keyframe_interval() const;
+  void _internal_set_keyframe_interval(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.TrajectoryRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fractal::JuliaRequest* frame_;
+    double step_real_;
+    double step_imag_;
+    int32_t frame_count_;
+    int32_t first_frame_;
+    int32_t lookahead_;
+    int32_t keyframe_interval_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrajectoryFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.TrajectoryFrame) */ {
+ public:
+  inline TrajectoryFrame() : TrajectoryFrame(nullptr) {}
+  ~TrajectoryFrame() override;
+  explicit PROTOBUF_CONSTEXPR TrajectoryFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TrajectoryFrame(const TrajectoryFrame& from);
+  TrajectoryFrame(TrajectoryFrame&& from) noexcept
+    : TrajectoryFrame() {
+    *this = ::std::move(from);
+  }
+
+  inline TrajectoryFrame& operator=(const TrajectoryFrame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrajectoryFrame& operator=(TrajectoryFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrajectoryFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrajectoryFrame* internal_default_instance() {
+    return reinterpret_cast<const TrajectoryFrame*>(
+               &_TrajectoryFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(TrajectoryFrame& a, TrajectoryFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrajectoryFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrajectoryFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TrajectoryFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrajectoryFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrajectoryFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrajectoryFrame& from) {
+    TrajectoryFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrajectoryFrame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.TrajectoryFrame";
+  }
+  protected:
+  explicit TrajectoryFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponseFieldNumber = 4,
+    kCRealFieldNumber = 2,
+    kCImagFieldNumber = 3,
+    kFrameIndexFieldNumber = 1,
+  };
+  // .fractal.JuliaResponse response = 4;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::fractal::JuliaResponse& response() const;
+  PROTOBUF_NODISCARD ::fractal::JuliaResponse* release_response();
+  ::fractal::JuliaResponse* mutable_response();
+  void set_allocated_response(::fractal::JuliaResponse* response);
+  private:
+  const ::fractal::JuliaResponse& _internal_response() const;
+  ::fractal::JuliaResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::fractal::JuliaResponse* response);
+  ::fractal::JuliaResponse* unsafe_arena_release_response();
+
+  // double c_real = 2;
+  void clear_c_real();
+  double c_real() const;
+  void set_c_real(double value);
+  private:
+  double _internal_c_real() const;
+  void _internal_set_c_real(double value);
+  public:
+
+  // double c_imag = 3;
+  void clear_c_imag();
+  double c_imag() const;
+  void set_c_imag(double value);
+  private:
+  double _internal_c_imag() const;
+  void _internal_set_c_imag(double value);
+  public:
+
+  // int32 frame_index = 1;
+  void clear_frame_index();
+  int32_t frame_index() const;
+  void set_frame_index(int32_t value);
+  private:
+  int32_t _internal_frame_index() const;
+  void _internal_set_frame_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.TrajectoryFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fractal::JuliaResponse* response_;
+    double c_real_;
+    double c_imag_;
+    int32_t frame_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.SessionUpdate) */ {
+ public:
+  inline SessionUpdate() : SessionUpdate(nullptr) {}
+  ~SessionUpdate() override;
+  explicit PROTOBUF_CONSTEXPR SessionUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionUpdate(const SessionUpdate& from);
+  SessionUpdate(SessionUpdate&& from) noexcept
+    : SessionUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionUpdate& operator=(const SessionUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionUpdate& operator=(SessionUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionUpdate* internal_default_instance() {
+    return reinterpret_cast<const SessionUpdate*>(
+               &_SessionUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SessionUpdate& a, SessionUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionUpdate& from) {
+    SessionUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.SessionUpdate";
+  }
+  protected:
+  explicit SessionUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrameFieldNumber = 2,
+    kSequenceFieldNumber = 1,
+  };
+  // .fractal.JuliaRequest frame = 2;
+  bool has_frame() const;
+  private:
+  bool _internal_has_frame() const;
+  public:
+  void clear_frame();
+  const ::fractal::JuliaRequest& frame() const;
+  PROTOBUF_NODISCARD ::fractal::JuliaRequest* release_frame();
+  ::fractal::JuliaRequest* mutable_frame();
+  void set_allocated_frame(::fractal::JuliaRequest* frame);
+  private:
+  const ::fractal::JuliaRequest& _internal_frame() const;
+  ::fractal::JuliaRequest* _internal_mutable_frame();
+  public:
+  void unsafe_arena_set_allocated_frame(
+      ::fractal::JuliaRequest* frame);
+  ::fractal::JuliaRequest* unsafe_arena_release_frame();
+
+  // uint64 sequence = 1;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.SessionUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fractal::JuliaRequest* frame_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.SessionFrame) */ {
+ public:
+  inline SessionFrame() : SessionFrame(nullptr) {}
+  ~SessionFrame() override;
+  explicit PROTOBUF_CONSTEXPR SessionFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionFrame(const SessionFrame& from);
+  SessionFrame(SessionFrame&& from) noexcept
+    : SessionFrame() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionFrame& operator=(const SessionFrame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionFrame& operator=(SessionFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionFrame* internal_default_instance() {
+    return reinterpret_cast<const SessionFrame*>(
+               &_SessionFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(SessionFrame& a, SessionFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionFrame& from) {
+    SessionFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionFrame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.SessionFrame";
+  }
+  protected:
+  explicit SessionFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponseFieldNumber = 2,
+    kSequenceFieldNumber = 1,
+    kDroppedUpdatesFieldNumber = 3,
+  };
+  // .fractal.JuliaResponse response = 2;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::fractal::JuliaResponse& response() const;
+  PROTOBUF_NODISCARD ::fractal::JuliaResponse* release_response();
+  ::fractal::JuliaResponse* mutable_response();
+  void set_allocated_response(::fractal::JuliaResponse* response);
+  private:
+  const ::fractal::JuliaResponse& _internal_response() const;
+  ::fractal::JuliaResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::fractal::JuliaResponse* response);
+  ::fractal::JuliaResponse* unsafe_arena_release_response();
+
+  // uint64 sequence = 1;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // uint32 dropped_updates = 3;
+  void clear_dropped_updates();
+  uint32_t dropped_updates() const;
+  void set_dropped_updates(uint32_t value);
+  private:
+  uint32_t _internal_dropped_updates() const;
+  void _internal_set_dropped_updates(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.SessionFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fractal::JuliaResponse* response_;
+    uint64_t sequence_;
+    uint32_t dropped_updates_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:fractal.ServerStatsRequest) */ {
+ public:
+  inline ServerStatsRequest() : ServerStatsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ServerStatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatsRequest(const ServerStatsRequest& from);
+  ServerStatsRequest(ServerStatsRequest&& from) noexcept
+    : ServerStatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatsRequest& operator=(const ServerStatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatsRequest& operator=(ServerStatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatsRequest* internal_default_instance() {
+    return reinterpret_cast<const ServerStatsRequest*>(
+               &_ServerStatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ServerStatsRequest& a, ServerStatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ServerStatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ServerStatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.ServerStatsRequest";
+  }
+  protected:
+  explicit ServerStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:fractal.ServerStatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.ServerStatsResponse) */ {
+ public:
+  inline ServerStatsResponse() : ServerStatsResponse(nullptr) {}
+  ~ServerStatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR ServerStatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatsResponse(const ServerStatsResponse& from);
+  ServerStatsResponse(ServerStatsResponse&& from) noexcept
+    : ServerStatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatsResponse& operator=(const ServerStatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatsResponse& operator=(ServerStatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatsResponse* internal_default_instance() {
+    return reinterpret_cast<const ServerStatsResponse*>(
+               &_ServerStatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ServerStatsResponse& a, ServerStatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStatsResponse& from) {
+    ServerStatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.ServerStatsResponse";
+  }
+  protected:
+  explicit ServerStatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerIdFieldNumber = 1,
+    kCacheHitsFieldNumber = 2,
+    kCacheMissesFieldNumber = 3,
+    kCacheEntriesFieldNumber = 4,
+    kCacheBytesFieldNumber = 5,
+    kCacheCapacityFieldNumber = 6,
+    kCacheEvictionsFieldNumber = 7,
+    kCoalescedRequestsFieldNumber = 8,
+    kDiskHitsFieldNumber = 9,
+    kDiskEntriesFieldNumber = 10,
+    kDiskBytesFieldNumber = 11,
+    kDiskCapacityFieldNumber = 12,
+  };
+  // string server_id = 1;
+  void clear_server_id();
+  const std::string& server_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server_id();
+  PROTOBUF_NODISCARD std::string* release_server_id();
+  void set_allocated_server_id(std::string* server_id);
+  private:
+  const std::string& _internal_server_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_id(const std::string& value);
+  std::string* _internal_mutable_server_id();
+  public:
+
+  // uint64 cache_hits = 2;
+  void clear_cache_hits();
+  uint64_t cache_hits() const;
+  void set_cache_hits(uint64_t value);
+  private:
+  uint64_t _internal_cache_hits() const;
+  void _internal_set_cache_hits(uint64_t value);
+  public:
+
+  // uint64 cache_misses = 3;
+  void clear_cache_misses();
+  uint64_t cache_misses() const;
+  void set_cache_misses(uint64_t value);
+  private:
+  uint64_t _internal_cache_misses() const;
+  void _internal_set_cache_misses(uint64_t value);
+  public:
+
+  // uint64 cache_entries = 4;
+  void clear_cache_entries();
+  uint64_t cache_entries() const;
+  void set_cache_entries(uint64_t value);
+  private:
+  uint64_t _internal_cache_entries() const;
+  void _internal_set_cache_entries(uint64_t value);
+  public:
+
+  // uint64 cache_bytes = 5;
+  void clear_cache_bytes();
+  uint64_t cache_bytes() const;
+  void set_cache_bytes(uint64_t value);
+  private:
+  uint64_t _internal_cache_bytes() const;
+  void _internal_set_cache_bytes(uint64_t value);
+  public:
+
+  // uint64 cache_capacity = 6;
+  void clear_cache_capacity();
+  uint64_t cache_capacity() const;
+  void set_cache_capacity(uint64_t value);
+  private:
+  uint64_t _internal_cache_capacity() const;
+  void _internal_set_cache_capacity(uint64_t value);
+  public:
+
+  // uint64 cache_evictions = 7;
+  void clear_cache_evictions();
+  uint64_t cache_evictions() const;
+  void set_cache_evictions(uint64_t value);
+  private:
+  uint64_t _internal_cache_evictions() const;
+  void _internal_set_cache_evictions(uint64_t value);
+  public:
+
+  // uint64 coalesced_requests = 8;
+  void clear_coalesced_requests();
+  uint64_t coalesced_requests() const;
+  void set_coalesced_requests(uint64_t value);
+  private:
+  uint64_t _internal_coalesced_requests() const;
+  void _internal_set_coalesced_requests(uint64_t value);
+  public:
+
+  // uint64 disk_hits = 9;
+  void clear_disk_hits();
+  uint64_t disk_hits() const;
+  void set_disk_hits(uint64_t value);
+  private:
+  uint64_t _internal_disk_hits() const;
+  void _internal_set_disk_hits(uint64_t value);
+  public:
+
+  // uint64 disk_entries = 10;
+  void clear_disk_entries();
+  uint64_t disk_entries() const;
+  void set_disk_entries(uint64_t value);
+  private:
+  uint64_t _internal_disk_entries() const;
+  void _internal_set_disk_entries(uint64_t value);
+  public:
+
+  // uint64 disk_bytes = 11;
+  void clear_disk_bytes();
+  uint64_t disk_bytes() const;
+  void set_disk_bytes(uint64_t value);
+  private:
+  uint64_t _internal_disk_bytes() const;
+  void _internal_set_disk_bytes(uint64_t value);
+  public:
+
+  // uint64 disk_capacity = 12;
+  void clear_disk_capacity();
+  uint64_t disk_capacity() const;
+  void set_disk_capacity(uint64_t value);
+  private:
+  uint64_t _internal_disk_capacity() const;
+  void _internal_set_disk_capacity(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.ServerStatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_id_;
+    uint64_t cache_hits_;
+    uint64_t cache_misses_;
+    uint64_t cache_entries_;
+    uint64_t cache_bytes_;
+    uint64_t cache_capacity_;
+    uint64_t cache_evictions_;
+    uint64_t coalesced_requests_;
+    uint64_t disk_hits_;
+    uint64_t disk_entries_;
+    uint64_t disk_bytes_;
+    uint64_t disk_capacity_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShutdownRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:fractal.ShutdownRequest) */ {
+ public:
+  inline ShutdownRequest() : ShutdownRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ShutdownRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShutdownRequest(const ShutdownRequest& from);
+  ShutdownRequest(ShutdownRequest&& from) noexcept
+    : ShutdownRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ShutdownRequest& operator=(const ShutdownRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShutdownRequest& operator=(ShutdownRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShutdownRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShutdownRequest* internal_default_instance() {
+    return reinterpret_cast<const ShutdownRequest*>(
+               &_ShutdownRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ShutdownRequest& a, ShutdownRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShutdownRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShutdownRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShutdownRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShutdownRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ShutdownRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ShutdownRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.ShutdownRequest";
+  }
+  protected:
+  explicit ShutdownRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:fractal.ShutdownRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShutdownResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fractal.ShutdownResponse) */ {
+ public:
+  inline ShutdownResponse() : ShutdownResponse(nullptr) {}
+  ~ShutdownResponse() override;
+  explicit PROTOBUF_CONSTEXPR ShutdownResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShutdownResponse(const ShutdownResponse& from);
+  ShutdownResponse(ShutdownResponse&& from) noexcept
+    : ShutdownResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ShutdownResponse& operator=(const ShutdownResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShutdownResponse& operator=(ShutdownResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShutdownResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShutdownResponse* internal_default_instance() {
+    return reinterpret_cast<const ShutdownResponse*>(
+               &_ShutdownResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ShutdownResponse& a, ShutdownResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShutdownResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShutdownResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShutdownResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShutdownResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShutdownResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShutdownResponse& from) {
+    ShutdownResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShutdownResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fractal.ShutdownResponse";
+  }
+  protected:
+  explicit ShutdownResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+  };
+  // string message = 1;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fractal.ShutdownResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fractal_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// JuliaRequest
+
+// double c_real = 1;
+inline void JuliaRequest::clear_c_real() {
+  _impl_.c_real_ = 0;
+}
+inline double JuliaRequest::_internal_c_real() const {
+  return _impl_.c_real_;
+}
+inline double JuliaRequest::c_real() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.c_real)
+  return _internal_c_real();
+}
+inline void JuliaRequest::_internal_set_c_real(double value) {
+  
+  _impl_.c_real_ = value;
+}
+inline void JuliaRequest::set_c_real(double value) {
+  _internal_set_c_real(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.c_real)
+}
+
+// double c_imag = 2;
+inline void JuliaRequest::clear_c_imag() {
+  _impl_.c_imag_ = 0;
+}
+inline double JuliaRequest::_internal_c_imag() const {
+  return _impl_.c_imag_;
+}
+inline double JuliaRequest::c_imag() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.c_imag)
+  return _internal_c_imag();
+}
+inline void JuliaRequest::_internal_set_c_imag(double value) {
+  
+  _impl_.c_imag_ = value;
+}
+inline void JuliaRequest::set_c_imag(double value) {
+  _internal_set_c_imag(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.c_imag)
+}
+
+// int32 width = 3;
+inline void JuliaRequest::clear_width() {
+  _impl_.width_ = 0;
+}
+inline int32_t JuliaRequest::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t JuliaRequest::width() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.width)
+  return _internal_width();
+}
+inline void JuliaRequest::_internal_set_width(int32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void JuliaRequest::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.width)
+}
+
+// int32 height = 4;
+inline void JuliaRequest::clear_height() {
+  _impl_.height_ = 0;
+}
+inline int32_t JuliaRequest::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t JuliaRequest::height() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.height)
+  return _internal_height();
+}
+inline void JuliaRequest::_internal_set_height(int32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void JuliaRequest::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.height)
+}
+
+// int32 max_iterations = 5;
+inline void JuliaRequest::clear_max_iterations() {
+  _impl_.max_iterations_ = 0;
+}
+inline int32_t JuliaRequest::_internal_max_iterations() const {
+  return _impl_.max_iterations_;
+}
+inline int32_t JuliaRequest::max_iterations() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.max_iterations)
+  return _internal_max_iterations();
+}
+inline void JuliaRequest::_internal_set_max_iterations(int32_t value) {
+  
+  _impl_.max_iterations_ = value;
+}
+inline void JuliaRequest::set_max_iterations(int32_t value) {
+  _internal_set_max_iterations(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.max_iterations)
+}
+
+// int32 poly_degree = 6;
+inline void JuliaRequest::clear_poly_degree() {
+  _impl_.poly_degree_ = 0;
+}
+inline int32_t JuliaRequest::_internal_poly_degree() const {
+  return _impl_.poly_degree_;
+}
+inline int32_t JuliaRequest::poly_degree() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.poly_degree)
+  return _internal_poly_degree();
+}
+inline void JuliaRequest::_internal_set_poly_degree(int32_t value) {
+  
+  _impl_.poly_degree_ = value;
+}
+inline void JuliaRequest::set_poly_degree(int32_t value) {
+  _internal_set_poly_degree(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.poly_degree)
+}
+
+// double x_min = 7;
+inline void JuliaRequest::clear_x_min() {
+  _impl_.x_min_ = 0;
+}
+inline double JuliaRequest::_internal_x_min() const {
+  return _impl_.x_min_;
+}
+inline double JuliaRequest::x_min() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.x_min)
+  return _internal_x_min();
+}
+inline void JuliaRequest::_internal_set_x_min(double value) {
+  
+  _impl_.x_min_ = value;
+}
+inline void JuliaRequest::set_x_min(double value) {
+  _internal_set_x_min(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.x_min)
+}
+
+// double x_max = 8;
+inline void JuliaRequest::clear_x_max() {
+  _impl_.x_max_ = 0;
+}
+inline double JuliaRequest::_internal_x_max() const {
+  return _impl_.x_max_;
+}
+inline double JuliaRequest::x_max() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.x_max)
+  return _internal_x_max();
+}
+inline void JuliaRequest::_internal_set_x_max(double value) {
+  
+  _impl_.x_max_ = value;
+}
+inline void JuliaRequest::set_x_max(double value) {
+  _internal_set_x_max(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.x_max)
+}
+
+// double y_min = 9;
+inline void JuliaRequest::clear_y_min() {
+  _impl_.y_min_ = 0;
+}
+inline double JuliaRequest::_internal_y_min() const {
+  return _impl_.y_min_;
+}
+inline double JuliaRequest::y_min() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.y_min)
+  return _internal_y_min();
+}
+inline void JuliaRequest::_internal_set_y_min(double value) {
+  
+  _impl_.y_min_ = value;
+}
+inline void JuliaRequest::set_y_min(double value) {
+  _internal_set_y_min(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.y_min)
+}
+
+// double y_max = 10;
+inline void JuliaRequest::clear_y_max() {
+  _impl_.y_max_ = 0;
+}
+inline double JuliaRequest::_internal_y_max() const {
+  return _impl_.y_max_;
+}
+inline double JuliaRequest::y_max() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.y_max)
+  return _internal_y_max();
+}
+inline void JuliaRequest::_internal_set_y_max(double value) {
+  
+  _impl_.y_max_ = value;
+}
+inline void JuliaRequest::set_y_max(double value) {
+  _internal_set_y_max(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.y_max)
+}
+
+// .fractal.FrameEncoding encoding = 11;
+inline void JuliaRequest::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::fractal::FrameEncoding JuliaRequest::_internal_encoding() const {
+  return static_cast< ::fractal::FrameEncoding >(_impl_.encoding_);
+}
+inline ::fractal::FrameEncoding JuliaRequest::encoding() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.encoding)
+  return _internal_encoding();
+}
+inline void JuliaRequest::_internal_set_encoding(::fractal::FrameEncoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void JuliaRequest::set_encoding(::fractal::FrameEncoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.encoding)
+}
+
+// .fractal.PixelFormat format = 12;
+inline void JuliaRequest::clear_format() {
+  _impl_.format_ = 0;
+}
+inline ::fractal::PixelFormat JuliaRequest::_internal_format() const {
+  return static_cast< ::fractal::PixelFormat >(_impl_.format_);
+}
+inline ::fractal::PixelFormat JuliaRequest::format() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.format)
+  return _internal_format();
+}
+inline void JuliaRequest::_internal_set_format(::fractal::PixelFormat value) {
+  
+  _impl_.format_ = value;
+}
+inline void JuliaRequest::set_format(::fractal::PixelFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.format)
+}
+
+// int32 theme = 13;
+inline void JuliaRequest::clear_theme() {
+  _impl_.theme_ = 0;
+}
+inline int32_t JuliaRequest::_internal_theme() const {
+  return _impl_.theme_;
+}
+inline int32_t JuliaRequest::theme() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.theme)
+  return _internal_theme();
+}
+inline void JuliaRequest::_internal_set_theme(int32_t value) {
+  
+  _impl_.theme_ = value;
+}
+inline void JuliaRequest::set_theme(int32_t value) {
+  _internal_set_theme(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.theme)
+}
+
+// bool progressive = 14;
+inline void JuliaRequest::clear_progressive() {
+  _impl_.progressive_ = false;
+}
+inline bool JuliaRequest::_internal_progressive() const {
+  return _impl_.progressive_;
+}
+inline bool JuliaRequest::progressive() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.progressive)
+  return _internal_progressive();
+}
+inline void JuliaRequest::_internal_set_progressive(bool value) {
+  
+  _impl_.progressive_ = value;
+}
+inline void JuliaRequest::set_progressive(bool value) {
+  _internal_set_progressive(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.progressive)
+}
+
+// bool shared_memory = 15;
+inline void JuliaRequest::clear_shared_memory() {
+  _impl_.shared_memory_ = false;
+}
+inline bool JuliaRequest::_internal_shared_memory() const {
+  return _impl_.shared_memory_;
+}
+inline bool JuliaRequest::shared_memory() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.shared_memory)
+  return _internal_shared_memory();
+}
+inline void JuliaRequest::_internal_set_shared_memory(bool value) {
+  
+  _impl_.shared_memory_ = value;
+}
+inline void JuliaRequest::set_shared_memory(bool value) {
+  _internal_set_shared_memory(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.shared_memory)
+}
+
+// -------------------------------------------------------------------
+
+// SharedFrame
+
+// string name = 1;
+inline void SharedFrame::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SharedFrame::name() const {
+  // @@protoc_insertion_point(field_get:fractal.SharedFrame.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SharedFrame::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fractal.SharedFrame.name)
+}
+inline std::string* SharedFrame::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:fractal.SharedFrame.name)
+  return _s;
+}
+inline const std::string& SharedFrame::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SharedFrame::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SharedFrame::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SharedFrame::release_name() {
+  // @@protoc_insertion_point(field_release:fractal.SharedFrame.name)
+  return _impl_.name_.Release();
+}
+inline void SharedFrame::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fractal.SharedFrame.name)
+}
+
+// uint64 instance = 2;
+inline void SharedFrame::clear_instance() {
+  _impl_.instance_ = uint64_t{0u};
+}
+inline uint64_t SharedFrame::_internal_instance() const {
+  return _impl_.instance_;
+}
+inline uint64_t SharedFrame::instance() const {
+  // @@protoc_insertion_point(field_get:fractal.SharedFrame.instance)
+  return _internal_instance();
+}
+inline void SharedFrame::_internal_set_instance(uint64_t value) {
+  
+  _impl_.instance_ = value;
+}
+inline void SharedFrame::set_instance(uint64_t value) {
+  _internal_set_instance(value);
+  // @@protoc_insertion_point(field_set:fractal.SharedFrame.instance)
+}
+
+// uint64 position = 3;
+inline void SharedFrame::clear_position() {
+  _impl_.position_ = uint64_t{0u};
+}
+inline uint64_t SharedFrame::_internal_position() const {
+  return _impl_.position_;
+}
+inline uint64_t SharedFrame::position() const {
+  // @@protoc_insertion_point(field_get:fractal.SharedFrame.position)
+  return _internal_position();
+}
+inline void SharedFrame::_internal_set_position(uint64_t value) {
+  
+  _impl_.position_ = value;
+}
+inline void SharedFrame::set_position(uint64_t value) {
+  _internal_set_position(value);
+  // @@protoc_insertion_point(field_set:fractal.SharedFrame.position)
+}
+
+// uint64 size = 4;
+inline void SharedFrame::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t SharedFrame::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t SharedFrame::size() const {
+  // @@protoc_insertion_point(field_get:fractal.SharedFrame.size)
+  return _internal_size();
+}
+inline void SharedFrame::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void SharedFrame::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:fractal.SharedFrame.size)
+}
+
+// -------------------------------------------------------------------
+
+// JuliaResponse
+
+// bytes rgba_data = 1;
+inline void JuliaResponse::clear_rgba_data() {
+  _impl_.rgba_data_.ClearToEmpty();
+}
+inline const std::string& JuliaResponse::rgba_data() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.rgba_data)
+  return _internal_rgba_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JuliaResponse::set_rgba_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rgba_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.rgba_data)
+}
+inline std::string* JuliaResponse::mutable_rgba_data() {
+  std::string* _s = _internal_mutable_rgba_data();
+  // @@protoc_insertion_point(field_mutable:fractal.JuliaResponse.rgba_data)
+  return _s;
+}
+inline const std::string& JuliaResponse::_internal_rgba_data() const {
+  return _impl_.rgba_data_.Get();
+}
+inline void JuliaResponse::_internal_set_rgba_data(const std::string& value) {
+  
+  _impl_.rgba_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JuliaResponse::_internal_mutable_rgba_data() {
+  
+  return _impl_.rgba_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JuliaResponse::release_rgba_data() {
+  // @@protoc_insertion_point(field_release:fractal.JuliaResponse.rgba_data)
+  return _impl_.rgba_data_.Release();
+}
+inline void JuliaResponse::set_allocated_rgba_data(std::string* rgba_data) {
+  if (rgba_data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rgba_data_.SetAllocated(rgba_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rgba_data_.IsDefault()) {
+    _impl_.rgba_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fractal.JuliaResponse.rgba_data)
+}
+
+// double calculation_time_ms = 2;
+inline void JuliaResponse::clear_calculation_time_ms() {
+  _impl_.calculation_time_ms_ = 0;
+}
+inline double JuliaResponse::_internal_calculation_time_ms() const {
+  return _impl_.calculation_time_ms_;
+}
+inline double JuliaResponse::calculation_time_ms() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.calculation_time_ms)
+  return _internal_calculation_time_ms();
+}
+inline void JuliaResponse::_internal_set_calculation_time_ms(double value) {
+  
+  _impl_.calculation_time_ms_ = value;
+}
+inline void JuliaResponse::set_calculation_time_ms(double value) {
+  _internal_set_calculation_time_ms(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.calculation_time_ms)
+}
+
+// string server_id = 3;
+inline void JuliaResponse::clear_server_id() {
+  _impl_.server_id_.ClearToEmpty();
+}
+inline const std::string& JuliaResponse::server_id() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.server_id)
+  return _internal_server_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JuliaResponse::set_server_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.server_id)
+}
+inline std::string* JuliaResponse::mutable_server_id() {
+  std::string* _s = _internal_mutable_server_id();
+  // @@protoc_insertion_point(field_mutable:fractal.JuliaResponse.server_id)
+  return _s;
+}
+inline const std::string& JuliaResponse::_internal_server_id() const {
+  return _impl_.server_id_.Get();
+}
+inline void JuliaResponse::_internal_set_server_id(const std::string& value) {
+  
+  _impl_.server_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JuliaResponse::_internal_mutable_server_id() {
+  
+  return _impl_.server_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JuliaResponse::release_server_id() {
+  // @@protoc_insertion_point(field_release:fractal.JuliaResponse.server_id)
+  return _impl_.server_id_.Release();
+}
+inline void JuliaResponse::set_allocated_server_id(std::string* server_id) {
+  if (server_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_id_.SetAllocated(server_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_id_.IsDefault()) {
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fractal.JuliaResponse.server_id)
+}
+
+// .fractal.FrameEncoding encoding = 4;
+inline void JuliaResponse::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::fractal::FrameEncoding JuliaResponse::_internal_encoding() const {
+  return static_cast< ::fractal::FrameEncoding >(_impl_.encoding_);
+}
+inline ::fractal::FrameEncoding JuliaResponse::encoding() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.encoding)
+  return _internal_encoding();
+}
+inline void JuliaResponse::_internal_set_encoding(::fractal::FrameEncoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void JuliaResponse::set_encoding(::fractal::FrameEncoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.encoding)
+}
+
+// .fractal.PixelFormat format = 5;
+inline void JuliaResponse::clear_format() {
+  _impl_.format_ = 0;
+}
+inline ::fractal::PixelFormat JuliaResponse::_internal_format() const {
+  return static_cast< ::fractal::PixelFormat >(_impl_.format_);
+}
+inline ::fractal::PixelFormat JuliaResponse::format() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.format)
+  return _internal_format();
+}
+inline void JuliaResponse::_internal_set_format(::fractal::PixelFormat value) {
+  
+  _impl_.format_ = value;
+}
+inline void JuliaResponse::set_format(::fractal::PixelFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.format)
+}
+
+// int32 scale = 6;
+inline void JuliaResponse::clear_scale() {
+  _impl_.scale_ = 0;
+}
+inline int32_t JuliaResponse::_internal_scale() const {
+  return _impl_.scale_;
+}
+inline int32_t JuliaResponse::scale() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.scale)
+  return _internal_scale();
+}
+inline void JuliaResponse::_internal_set_scale(int32_t value) {
+  
+  _impl_.scale_ = value;
+}
+inline void JuliaResponse::set_scale(int32_t value) {
+  _internal_set_scale(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.scale)
+}
+
+// bool delta = 7;
+inline void JuliaResponse::clear_delta() {
+  _impl_.delta_ = false;
+}
+inline bool JuliaResponse::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline bool JuliaResponse::delta() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.delta)
+  return _internal_delta();
+}
+inline void JuliaResponse::_internal_set_delta(bool value) {
+  
+  _impl_.delta_ = value;
+}
+inline void JuliaResponse::set_delta(bool value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.delta)
+}
+
+// .fractal.SharedFrame shared = 8;
+inline bool JuliaResponse::_internal_has_shared() const {
+  return this != internal_default_instance() && _impl_.shared_ != nullptr;
+}
+inline bool JuliaResponse::has_shared() const {
+  return _internal_has_shared();
+}
+inline void JuliaResponse::clear_shared() {
+  if (GetArenaForAllocation() == nullptr && _impl_.shared_ != nullptr) {
+    delete _impl_.shared_;
+  }
+  _impl_.shared_ = nullptr;
+}
+inline const ::fractal::SharedFrame& JuliaResponse::_internal_shared() const {
+  const ::fractal::SharedFrame* p = _impl_.shared_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fractal::SharedFrame&>(
+      ::fractal::_SharedFrame_default_instance_);
+}
+inline const ::fractal::SharedFrame& JuliaResponse::shared() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.shared)
+  return _internal_shared();
+}
+inline void JuliaResponse::unsafe_arena_set_allocated_shared(
+    ::fractal::SharedFrame* shared) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shared_);
+  }
+  _impl_.shared_ = shared;
+  if (shared) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fractal.JuliaResponse.shared)
+}
+inline ::fractal::SharedFrame* JuliaResponse::release_shared() {
+  
+  ::fractal::SharedFrame* temp = _impl_.shared_;
+  _impl_.shared_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fractal::SharedFrame* JuliaResponse::unsafe_arena_release_shared() {
+  // @@protoc_insertion_point(field_release:fractal.JuliaResponse.shared)
+  
+  ::fractal::SharedFrame* temp = _impl_.shared_;
+  _impl_.shared_ = nullptr;
+  return temp;
+}
+inline ::fractal::SharedFrame* JuliaResponse::_internal_mutable_shared() {
+  
+  if (_impl_.shared_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fractal::SharedFrame>(GetArenaForAllocation());
+    _impl_.shared_ = p;
+  }
+  return _impl_.shared_;
+}
+inline ::fractal::SharedFrame* JuliaResponse::mutable_shared() {
+  ::fractal::SharedFrame* _msg = _internal_mutable_shared();
+  // @@protoc_insertion_point(field_mutable:fractal.JuliaResponse.shared)
+  return _msg;
+}
+inline void JuliaResponse::set_allocated_shared(::fractal::SharedFrame* shared) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.shared_;
+  }
+  if (shared) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(shared);
+    if (message_arena != submessage_arena) {
+      shared = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shared, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.shared_ = shared;
+  // @@protoc_insertion_point(field_set_allocated:fractal.JuliaResponse.shared)
+}
+
+// -------------------------------------------------------------------
+
+// JuliaBatchRequest
+
+// repeated .fractal.JuliaRequest requests = 1;
+inline int JuliaBatchRequest::_internal_requests_size() const {
+  return _impl_.requests_.size();
+}
+inline int JuliaBatchRequest::requests_size() const {
+  return _internal_requests_size();
+}
+inline void JuliaBatchRequest::clear_requests() {
+  _impl_.requests_.Clear();
+}
+inline ::fractal::JuliaRequest* JuliaBatchRequest::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:fractal.JuliaBatchRequest.requests)
+  return _impl_.requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fractal::JuliaRequest >*
+JuliaBatchRequest::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:fractal.JuliaBatchRequest.requests)
+  return &_impl_.requests_;
+}
+inline const ::fractal::JuliaRequest& JuliaBatchRequest::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
+}
+inline const ::fractal::JuliaRequest& JuliaBatchRequest::requests(int index) const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaBatchRequest.requests)
+  return _internal_requests(index);
+}
+inline ::fractal::JuliaRequest* JuliaBatchRequest::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline ::fractal::JuliaRequest* JuliaBatchRequest::add_requests() {
+  ::fractal::JuliaRequest* _add = _internal_add_requests();
+  // @@protoc_insertion_point(field_add:fractal.JuliaBatchRequest.requests)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fractal::JuliaRequest >&
+JuliaBatchRequest::requests() const {
+  // @@protoc_insertion_point(field_list:fractal.JuliaBatchRequest.requests)
+  return _impl_.requests_;
+}
+
+// -------------------------------------------------------------------
+
+// JuliaBatchResponse
+
+// int32 index = 1;
+inline void JuliaBatchResponse::clear_index() {
+  _impl_.index_ = 0;
+}
+inline int32_t JuliaBatchResponse::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t JuliaBatchResponse::index() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaBatchResponse.index)
+  return _internal_index();
+}
+inline void JuliaBatchResponse::_internal_set_index(int32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void JuliaBatchResponse::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:fractal.JuliaBatchResponse.index)
+}
+
+// .fractal.JuliaResponse response = 2;
+inline bool JuliaBatchResponse::_internal_has_response() const {
+  return this != internal_default_instance() && _impl_.response_ != nullptr;
+}
+inline bool JuliaBatchResponse::has_response() const {
+  return _internal_has_response();
+}
+inline void JuliaBatchResponse::clear_response() {
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+}
+inline const ::fractal::JuliaResponse& JuliaBatchResponse::_internal_response() const {
+  const ::fractal::JuliaResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fractal::JuliaResponse&>(
+      ::fractal::_JuliaResponse_default_instance_);
+}
+inline const ::fractal::JuliaResponse& JuliaBatchResponse::response() const {
+  // @@protoc_insertion_point(field_get:fractal.JuliaBatchResponse.response)
+  return _internal_response();
+}
+inline void JuliaBatchResponse::unsafe_arena_set_allocated_response(
+    ::fractal::JuliaResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
+  }
+  _impl_.response_ = response;
+  if (response) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fractal.JuliaBatchResponse.response)
+}
+inline ::fractal::JuliaResponse* JuliaBatchResponse::release_response() {
+  
+  ::fractal::JuliaResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fractal::JuliaResponse* JuliaBatchResponse::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_release:fractal.JuliaBatchResponse.response)
+  
+  ::fractal::JuliaResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+  return temp;
+}
+inline ::fractal::JuliaResponse* JuliaBatchResponse::_internal_mutable_response() {
+  
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fractal::JuliaResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
+  }
+  return _impl_.response_;
+}
+inline ::fractal::JuliaResponse* JuliaBatchResponse::mutable_response() {
+  ::fractal::JuliaResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:fractal.JuliaBatchResponse.response)
+  return _msg;
+}
+inline void JuliaBatchResponse::set_allocated_response(::fractal::JuliaResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.response_;
+  }
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.response_ = response;
+  // @@protoc_insertion_point(field_set_allocated:fractal.JuliaBatchResponse.response)
+}
+
+// -------------------------------------------------------------------
+
+// FrameChunk
+
+// int32 first_row = 1;
+inline void FrameChunk::clear_first_row() {
+  _impl_.first_row_ = 0;
+}
+inline int32_t FrameChunk::_internal_first_row() const {
+  return _impl_.first_row_;
+}
+inline int32_t FrameChunk::first_row() const {
+  // @@protoc_insertion_point(field_get:fractal.FrameChunk.first_row)
+  return _internal_first_row();
+}
+inline void FrameChunk::_internal_set_first_row(int32_t value) {
+  
+  _impl_.first_row_ = value;
+}
+inline void FrameChunk::set_first_row(int32_t value) {
+  _internal_set_first_row(value);
+  // @@protoc_insertion_point(field_set:fractal.FrameChunk.first_row)
+}
+
+// int32 rows = 2;
+inline void FrameChunk::clear_rows() {
+  _impl_.rows_ = 0;
+}
+inline int32_t FrameChunk::_internal_rows() const {
+  return _impl_.rows_;
+}
+inline int32_t FrameChunk::rows() const {
+  // @@protoc_insertion_point(field_get:fractal.FrameChunk.rows)
+  return _internal_rows();
+}
+inline void FrameChunk::_internal_set_rows(int32_t value) {
+  
+  _impl_.rows_ = value;
+}
+inline void FrameChunk::set_rows(int32_t value) {
+  _internal_set_rows(value);
+  // @@protoc_insertion_point(field_set:fractal.FrameChunk.rows)
+}
+
+// bytes data = 3;
+inline void FrameChunk::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& FrameChunk::data() const {
+  // @@protoc_insertion_point(field_get:fractal.FrameChunk.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FrameChunk::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fractal.FrameChunk.data)
+}
+inline std::string* FrameChunk::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:fractal.FrameChunk.data)
+  return _s;
+}
+inline const std::string& FrameChunk::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void FrameChunk::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FrameChunk::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FrameChunk::release_data() {
+  // @@protoc_insertion_point(field_release:fractal.FrameChunk.data)
+  return _impl_.data_.Release();
+}
+inline void FrameChunk::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fractal.FrameChunk.data)
+}
 
-  // @@protoc_insertion_point(class_scope:fractal.ShutdownResponse)
- private:
-  class _Internal;
+// .fractal.FrameEncoding encoding = 4;
+inline void FrameChunk::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::fractal::FrameEncoding FrameChunk::_internal_encoding() const {
+  return static_cast< ::fractal::FrameEncoding >(_impl_.encoding_);
+}
+inline ::fractal::FrameEncoding FrameChunk::encoding() const {
+  // @@protoc_insertion_point(field_get:fractal.FrameChunk.encoding)
+  return _internal_encoding();
+}
+inline void FrameChunk::_internal_set_encoding(::fractal::FrameEncoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void FrameChunk::set_encoding(::fractal::FrameEncoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:fractal.FrameChunk.encoding)
+}
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_fractal_2eproto;
-};
-// ===================================================================
+// .fractal.PixelFormat format = 5;
+inline void FrameChunk::clear_format() {
+  _impl_.format_ = 0;
+}
+inline ::fractal::PixelFormat FrameChunk::_internal_format() const {
+  return static_cast< ::fractal::PixelFormat >(_impl_.format_);
+}
+inline ::fractal::PixelFormat FrameChunk::format() const {
+  // @@protoc_insertion_point(field_get:fractal.FrameChunk.format)
+  return _internal_format();
+}
+inline void FrameChunk::_internal_set_format(::fractal::PixelFormat value) {
+  
+  _impl_.format_ = value;
+}
+inline void FrameChunk::set_format(::fractal::PixelFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:fractal.FrameChunk.format)
+}
 
+// double calculation_time_ms = 6;
+inline void FrameChunk::clear_calculation_time_ms() {
+  _impl_.calculation_time_ms_ = 0;
+}
+inline double FrameChunk::_internal_calculation_time_ms() const {
+  return _impl_.calculation_time_ms_;
+}
+inline double FrameChunk::calculation_time_ms() const {
+  // @@protoc_insertion_point(field_get:fractal.FrameChunk.calculation_time_ms)
+  return _internal_calculation_time_ms();
+}
+inline void FrameChunk::_internal_set_calculation_time_ms(double value) {
+  
+  _impl_.calculation_time_ms_ = value;
+}
+inline void FrameChunk::set_calculation_time_ms(double value) {
+  _internal_set_calculation_time_ms(value);
+  // @@protoc_insertion_point(field_set:fractal.FrameChunk.calculation_time_ms)
+}
 
-// ===================================================================
+// string server_id = 7;
+inline void FrameChunk::clear_server_id() {
+  _impl_.server_id_.ClearToEmpty();
+}
+inline const std::string& FrameChunk::server_id() const {
+  // @@protoc_insertion_point(field_get:fractal.FrameChunk.server_id)
+  return _internal_server_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FrameChunk::set_server_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fractal.FrameChunk.server_id)
+}
+inline std::string* FrameChunk::mutable_server_id() {
+  std::string* _s = _internal_mutable_server_id();
+  // @@protoc_insertion_point(field_mutable:fractal.FrameChunk.server_id)
+  return _s;
+}
+inline const std::string& FrameChunk::_internal_server_id() const {
+  return _impl_.server_id_.Get();
+}
+inline void FrameChunk::_internal_set_server_id(const std::string& value) {
+  
+  _impl_.server_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FrameChunk::_internal_mutable_server_id() {
+  
+  return _impl_.server_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FrameChunk::release_server_id() {
+  // @@protoc_insertion_point(field_release:fractal.FrameChunk.server_id)
+  return _impl_.server_id_.Release();
+}
+inline void FrameChunk::set_allocated_server_id(std::string* server_id) {
+  if (server_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_id_.SetAllocated(server_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_id_.IsDefault()) {
+    _impl_.server_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fractal.FrameChunk.server_id)
+}
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// JuliaRequest
+// -------------------------------------------------------------------
 
-// double c_real = 1;
-inline void JuliaRequest::clear_c_real() {
-  _impl_.c_real_ = 0;
+// TrajectoryRequest
+
+// .fractal.JuliaRequest frame = 1;
+inline bool TrajectoryRequest::_internal_has_frame() const {
+  return this != internal_default_instance() && _impl_.frame_ != nullptr;
 }
-inline double JuliaRequest::_internal_c_real() const {
-  return _impl_.c_real_;
+inline bool TrajectoryRequest::has_frame() const {
+  return _internal_has_frame();
 }
-inline double JuliaRequest::c_real() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.c_real)
-  return _internal_c_real();
+inline void TrajectoryRequest::clear_frame() {
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_ != nullptr) {
+    delete _impl_.frame_;
+  }
+  _impl_.frame_ = nullptr;
 }
-inline void JuliaRequest::_internal_set_c_real(double value) {
+inline const ::fractal::JuliaRequest& TrajectoryRequest::_internal_frame() const {
+  const ::fractal::JuliaRequest* p = _impl_.frame_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fractal::JuliaRequest&>(
+      ::fractal::_JuliaRequest_default_instance_);
+}
+inline const ::fractal::JuliaRequest& TrajectoryRequest::frame() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryRequest.frame)
+  return _internal_frame();
+}
+inline void TrajectoryRequest::unsafe_arena_set_allocated_frame(
+    ::fractal::JuliaRequest* frame) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.frame_);
+  }
+  _impl_.frame_ = frame;
+  if (frame) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fractal.TrajectoryRequest.frame)
+}
+inline ::fractal::JuliaRequest* TrajectoryRequest::release_frame() {
   
-  _impl_.c_real_ = value;
+  ::fractal::JuliaRequest* temp = _impl_.frame_;
+  _impl_.frame_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void JuliaRequest::set_c_real(double value) {
-  _internal_set_c_real(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.c_real)
+inline ::fractal::JuliaRequest* TrajectoryRequest::unsafe_arena_release_frame() {
+  // @@protoc_insertion_point(field_release:fractal.TrajectoryRequest.frame)
+  
+  ::fractal::JuliaRequest* temp = _impl_.frame_;
+  _impl_.frame_ = nullptr;
+  return temp;
+}
+inline ::fractal::JuliaRequest* TrajectoryRequest::_internal_mutable_frame() {
+  
+  if (_impl_.frame_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fractal::JuliaRequest>(GetArenaForAllocation());
+    _impl_.frame_ = p;
+  }
+  return _impl_.frame_;
+}
+inline ::fractal::JuliaRequest* TrajectoryRequest::mutable_frame() {
+  ::fractal::JuliaRequest* _msg = _internal_mutable_frame();
+  // @@protoc_insertion_point(field_mutable:fractal.TrajectoryRequest.frame)
+  return _msg;
+}
+inline void TrajectoryRequest::set_allocated_frame(::fractal::JuliaRequest* frame) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.frame_;
+  }
+  if (frame) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(frame);
+    if (message_arena != submessage_arena) {
+      frame = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frame, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.frame_ = frame;
+  // @@protoc_insertion_point(field_set_allocated:fractal.TrajectoryRequest.frame)
 }
 
-// double c_imag = 2;
-inline void JuliaRequest::clear_c_imag() {
-  _impl_.c_imag_ = 0;
+// double step_real = 2;
+inline void TrajectoryRequest::clear_step_real() {
+  _impl_.step_real_ = 0;
 }
-inline double JuliaRequest::_internal_c_imag() const {
-  return _impl_.c_imag_;
+inline double TrajectoryRequest::_internal_step_real() const {
+  return _impl_.step_real_;
 }
-inline double JuliaRequest::c_imag() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.c_imag)
-  return _internal_c_imag();
+inline double TrajectoryRequest::step_real() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryRequest.step_real)
+  return _internal_step_real();
 }
-inline void JuliaRequest::_internal_set_c_imag(double value) {
+inline void TrajectoryRequest::_internal_set_step_real(double value) {
   
-  _impl_.c_imag_ = value;
+  _impl_.step_real_ = value;
 }
-inline void JuliaRequest::set_c_imag(double value) {
-  _internal_set_c_imag(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.c_imag)
+inline void TrajectoryRequest::set_step_real(double value) {
+  _internal_set_step_real(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryRequest.step_real)
 }
 
-// int32 width = 3;
-inline void JuliaRequest::clear_width() {
-  _impl_.width_ = 0;
+// double step_imag = 3;
+inline void TrajectoryRequest::clear_step_imag() {
+  _impl_.step_imag_ = 0;
 }
-inline int32_t JuliaRequest::_internal_width() const {
-  return _impl_.width_;
+inline double TrajectoryRequest::_internal_step_imag() const {
+  return _impl_.step_imag_;
 }
-inline int32_t JuliaRequest::width() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.width)
-  return _internal_width();
+inline double TrajectoryRequest::step_imag() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryRequest.step_imag)
+  return _internal_step_imag();
 }
-inline void JuliaRequest::_internal_set_width(int32_t value) {
+inline void TrajectoryRequest::_internal_set_step_imag(double value) {
   
-  _impl_.width_ = value;
+  _impl_.step_imag_ = value;
 }
-inline void JuliaRequest::set_width(int32_t value) {
-  _internal_set_width(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.width)
+inline void TrajectoryRequest::set_step_imag(double value) {
+  _internal_set_step_imag(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryRequest.step_imag)
 }
 
-// int32 height = 4;
-inline void JuliaRequest::clear_height() {
-  _impl_.height_ = 0;
+// int32 frame_count = 4;
+inline void TrajectoryRequest::clear_frame_count() {
+  _impl_.frame_count_ = 0;
 }
-inline int32_t JuliaRequest::_internal_height() const {
-  return _impl_.height_;
+inline int32_t TrajectoryRequest::_internal_frame_count() const {
+  return _impl_.frame_count_;
 }
-inline int32_t JuliaRequest::height() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.height)
-  return _internal_height();
+inline int32_t TrajectoryRequest::frame_count() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryRequest.frame_count)
+  return _internal_frame_count();
 }
-inline void JuliaRequest::_internal_set_height(int32_t value) {
+inline void TrajectoryRequest::_internal_set_frame_count(int32_t value) {
   
-  _impl_.height_ = value;
+  _impl_.frame_count_ = value;
 }
-inline void JuliaRequest::set_height(int32_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.height)
+inline void TrajectoryRequest::set_frame_count(int32_t value) {
+  _internal_set_frame_count(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryRequest.frame_count)
 }
 
-// int32 max_iterations = 5;
-inline void JuliaRequest::clear_max_iterations() {
-  _impl_.max_iterations_ = 0;
+// int32 first_frame = 5;
+inline void TrajectoryRequest::clear_first_frame() {
+  _impl_.first_frame_ = 0;
 }
-inline int32_t JuliaRequest::_internal_max_iterations() const {
-  return _impl_.max_iterations_;
+inline int32_t TrajectoryRequest::_internal_first_frame() const {
+  return _impl_.first_frame_;
 }
-inline int32_t JuliaRequest::max_iterations() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.max_iterations)
-  return _internal_max_iterations();
+inline int32_t TrajectoryRequest::first_frame() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryRequest.first_frame)
+  return _internal_first_frame();
 }
-inline void JuliaRequest::_internal_set_max_iterations(int32_t value) {
+inline void TrajectoryRequest::_internal_set_first_frame(int32_t value) {
   
-  _impl_.max_iterations_ = value;
+  _impl_.first_frame_ = value;
 }
-inline void JuliaRequest::set_max_iterations(int32_t value) {
-  _internal_set_max_iterations(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.max_iterations)
+inline void TrajectoryRequest::set_first_frame(int32_t value) {
+  _internal_set_first_frame(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryRequest.first_frame)
 }
 
-// int32 poly_degree = 6;
-inline void JuliaRequest::clear_poly_degree() {
-  _impl_.poly_degree_ = 0;
+// int32 lookahead = 6;
+inline void TrajectoryRequest::clear_lookahead() {
+  _impl_.lookahead_ = 0;
 }
-inline int32_t JuliaRequest::_internal_poly_degree() const {
-  return _impl_.poly_degree_;
+inline int32_t TrajectoryRequest::_internal_lookahead() const {
+  return _impl_.lookahead_;
 }
-inline int32_t JuliaRequest::poly_degree() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.poly_degree)
-  return _internal_poly_degree();
+inline int32_t TrajectoryRequest::lookahead() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryRequest.lookahead)
+  return _internal_lookahead();
 }
-inline void JuliaRequest::_internal_set_poly_degree(int32_t value) {
+inline void TrajectoryRequest::_internal_set_lookahead(int32_t value) {
   
-  _impl_.poly_degree_ = value;
+  _impl_.lookahead_ = value;
 }
-inline void JuliaRequest::set_poly_degree(int32_t value) {
-  _internal_set_poly_degree(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.poly_degree)
+inline void TrajectoryRequest::set_lookahead(int32_t value) {
+  _internal_set_lookahead(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryRequest.lookahead)
 }
 
-// double x_min = 7;
-inline void JuliaRequest::clear_x_min() {
-  _impl_.x_min_ = 0;
+// int32 keyframe_interval = 7;
+inline void TrajectoryRequest::clear_keyframe_interval() {
+  _impl_.keyframe_interval_ = 0;
 }
-inline double JuliaRequest::_internal_x_min() const {
-  return _impl_.x_min_;
+inline int32_t TrajectoryRequest::_internal_keyframe_interval() const {
+  return _impl_.keyframe_interval_;
 }
-inline double JuliaRequest::x_min() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.x_min)
-  return _internal_x_min();
+inline int32_t TrajectoryRequest::keyframe_interval() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryRequest.keyframe_interval)
+  return _internal_keyframe_interval();
 }
-inline void JuliaRequest::_internal_set_x_min(double value) {
+inline void TrajectoryRequest::_internal_set_keyframe_interval(int32_t value) {
   
-  _impl_.x_min_ = value;
+  _impl_.keyframe_interval_ = value;
 }
-inline void JuliaRequest::set_x_min(double value) {
-  _internal_set_x_min(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.x_min)
+inline void TrajectoryRequest::set_keyframe_interval(int32_t value) {
+  _internal_set_keyframe_interval(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryRequest.keyframe_interval)
+}
+
+// -------------------------------------------------------------------
+
+// TrajectoryFrame
+
+// int32 frame_index = 1;
+inline void TrajectoryFrame::clear_frame_index() {
+  _impl_.frame_index_ = 0;
+}
+inline int32_t TrajectoryFrame::_internal_frame_index() const {
+  return _impl_.frame_index_;
+}
+inline int32_t TrajectoryFrame::frame_index() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryFrame.frame_index)
+  return _internal_frame_index();
+}
+inline void TrajectoryFrame::_internal_set_frame_index(int32_t value) {
+  
+  _impl_.frame_index_ = value;
+}
+inline void TrajectoryFrame::set_frame_index(int32_t value) {
+  _internal_set_frame_index(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryFrame.frame_index)
+}
+
+// double c_real = 2;
+inline void TrajectoryFrame::clear_c_real() {
+  _impl_.c_real_ = 0;
+}
+inline double TrajectoryFrame::_internal_c_real() const {
+  return _impl_.c_real_;
+}
+inline double TrajectoryFrame::c_real() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryFrame.c_real)
+  return _internal_c_real();
+}
+inline void TrajectoryFrame::_internal_set_c_real(double value) {
+  
+  _impl_.c_real_ = value;
+}
+inline void TrajectoryFrame::set_c_real(double value) {
+  _internal_set_c_real(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryFrame.c_real)
+}
+
+// double c_imag = 3;
+inline void TrajectoryFrame::clear_c_imag() {
+  _impl_.c_imag_ = 0;
+}
+inline double TrajectoryFrame::_internal_c_imag() const {
+  return _impl_.c_imag_;
+}
+inline double TrajectoryFrame::c_imag() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryFrame.c_imag)
+  return _internal_c_imag();
+}
+inline void TrajectoryFrame::_internal_set_c_imag(double value) {
+  
+  _impl_.c_imag_ = value;
+}
+inline void TrajectoryFrame::set_c_imag(double value) {
+  _internal_set_c_imag(value);
+  // @@protoc_insertion_point(field_set:fractal.TrajectoryFrame.c_imag)
+}
+
+// .fractal.JuliaResponse response = 4;
+inline bool TrajectoryFrame::_internal_has_response() const {
+  return this != internal_default_instance() && _impl_.response_ != nullptr;
+}
+inline bool TrajectoryFrame::has_response() const {
+  return _internal_has_response();
+}
+inline void TrajectoryFrame::clear_response() {
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+}
+inline const ::fractal::JuliaResponse& TrajectoryFrame::_internal_response() const {
+  const ::fractal::JuliaResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fractal::JuliaResponse&>(
+      ::fractal::_JuliaResponse_default_instance_);
+}
+inline const ::fractal::JuliaResponse& TrajectoryFrame::response() const {
+  // @@protoc_insertion_point(field_get:fractal.TrajectoryFrame.response)
+  return _internal_response();
+}
+inline void TrajectoryFrame::unsafe_arena_set_allocated_response(
+    ::fractal::JuliaResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
+  }
+  _impl_.response_ = response;
+  if (response) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fractal.TrajectoryFrame.response)
+}
+inline ::fractal::JuliaResponse* TrajectoryFrame::release_response() {
+  
+  ::fractal::JuliaResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fractal::JuliaResponse* TrajectoryFrame::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_release:fractal.TrajectoryFrame.response)
+  
+  ::fractal::JuliaResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+  return temp;
+}
+inline ::fractal::JuliaResponse* TrajectoryFrame::_internal_mutable_response() {
+  
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fractal::JuliaResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
+  }
+  return _impl_.response_;
+}
+inline ::fractal::JuliaResponse* TrajectoryFrame::mutable_response() {
+  ::fractal::JuliaResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:fractal.TrajectoryFrame.response)
+  return _msg;
+}
+inline void TrajectoryFrame::set_allocated_response(::fractal::JuliaResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.response_;
+  }
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.response_ = response;
+  // @@protoc_insertion_point(field_set_allocated:fractal.TrajectoryFrame.response)
 }
 
-// double x_max = 8;
-inline void JuliaRequest::clear_x_max() {
-  _impl_.x_max_ = 0;
+// -------------------------------------------------------------------
+
+// SessionUpdate
+
+// uint64 sequence = 1;
+inline void SessionUpdate::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
 }
-inline double JuliaRequest::_internal_x_max() const {
-  return _impl_.x_max_;
+inline uint64_t SessionUpdate::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-inline double JuliaRequest::x_max() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.x_max)
-  return _internal_x_max();
+inline uint64_t SessionUpdate::sequence() const {
+  // @@protoc_insertion_point(field_get:fractal.SessionUpdate.sequence)
+  return _internal_sequence();
 }
-inline void JuliaRequest::_internal_set_x_max(double value) {
+inline void SessionUpdate::_internal_set_sequence(uint64_t value) {
   
-  _impl_.x_max_ = value;
+  _impl_.sequence_ = value;
 }
-inline void JuliaRequest::set_x_max(double value) {
-  _internal_set_x_max(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.x_max)
+inline void SessionUpdate::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:fractal.SessionUpdate.sequence)
 }
 
-// double y_min = 9;
-inline void JuliaRequest::clear_y_min() {
-  _impl_.y_min_ = 0;
+// .fractal.JuliaRequest frame = 2;
+inline bool SessionUpdate::_internal_has_frame() const {
+  return this != internal_default_instance() && _impl_.frame_ != nullptr;
 }
-inline double JuliaRequest::_internal_y_min() const {
-  return _impl_.y_min_;
+inline bool SessionUpdate::has_frame() const {
+  return _internal_has_frame();
 }
-inline double JuliaRequest::y_min() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.y_min)
-  return _internal_y_min();
+inline void SessionUpdate::clear_frame() {
+  if (GetArenaForAllocation() == nullptr && _impl_.frame_ != nullptr) {
+    delete _impl_.frame_;
+  }
+  _impl_.frame_ = nullptr;
 }
-inline void JuliaRequest::_internal_set_y_min(double value) {
-  
-  _impl_.y_min_ = value;
+inline const ::fractal::JuliaRequest& SessionUpdate::_internal_frame() const {
+  const ::fractal::JuliaRequest* p = _impl_.frame_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fractal::JuliaRequest&>(
+      ::fractal::_JuliaRequest_default_instance_);
 }
-inline void JuliaRequest::set_y_min(double value) {
-  _internal_set_y_min(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.y_min)
+inline const ::fractal::JuliaRequest& SessionUpdate::frame() const {
+  // @@protoc_insertion_point(field_get:fractal.SessionUpdate.frame)
+  return _internal_frame();
 }
-
-// double y_max = 10;
-inline void JuliaRequest::clear_y_max() {
-  _impl_.y_max_ = 0;
+inline void SessionUpdate::unsafe_arena_set_allocated_frame(
+    ::fractal::JuliaRequest* frame) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.frame_);
+  }
+  _impl_.frame_ = frame;
+  if (frame) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fractal.SessionUpdate.frame)
 }
-inline double JuliaRequest::_internal_y_max() const {
-  return _impl_.y_max_;
+inline ::fractal::JuliaRequest* SessionUpdate::release_frame() {
+  
+  ::fractal::JuliaRequest* temp = _impl_.frame_;
+  _impl_.frame_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline double JuliaRequest::y_max() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaRequest.y_max)
-  return _internal_y_max();
+inline ::fractal::JuliaRequest* SessionUpdate::unsafe_arena_release_frame() {
+  // @@protoc_insertion_point(field_release:fractal.SessionUpdate.frame)
+  
+  ::fractal::JuliaRequest* temp = _impl_.frame_;
+  _impl_.frame_ = nullptr;
+  return temp;
 }
-inline void JuliaRequest::_internal_set_y_max(double value) {
+inline ::fractal::JuliaRequest* SessionUpdate::_internal_mutable_frame() {
   
-  _impl_.y_max_ = value;
+  if (_impl_.frame_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fractal::JuliaRequest>(GetArenaForAllocation());
+    _impl_.frame_ = p;
+  }
+  return _impl_.frame_;
 }
-inline void JuliaRequest::set_y_max(double value) {
-  _internal_set_y_max(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaRequest.y_max)
+inline ::fractal::JuliaRequest* SessionUpdate::mutable_frame() {
+  ::fractal::JuliaRequest* _msg = _internal_mutable_frame();
+  // @@protoc_insertion_point(field_mutable:fractal.SessionUpdate.frame)
+  return _msg;
+}
+inline void SessionUpdate::set_allocated_frame(::fractal::JuliaRequest* frame) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.frame_;
+  }
+  if (frame) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(frame);
+    if (message_arena != submessage_arena) {
+      frame = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frame, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.frame_ = frame;
+  // @@protoc_insertion_point(field_set_allocated:fractal.SessionUpdate.frame)
 }
 
 // -------------------------------------------------------------------
 
-// JuliaResponse
+// SessionFrame
 
-// bytes rgba_data = 1;
-inline void JuliaResponse::clear_rgba_data() {
-  _impl_.rgba_data_.ClearToEmpty();
+// uint64 sequence = 1;
+inline void SessionFrame::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
 }
-inline const std::string& JuliaResponse::rgba_data() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.rgba_data)
-  return _internal_rgba_data();
+inline uint64_t SessionFrame::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void JuliaResponse::set_rgba_data(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.rgba_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.rgba_data)
+inline uint64_t SessionFrame::sequence() const {
+  // @@protoc_insertion_point(field_get:fractal.SessionFrame.sequence)
+  return _internal_sequence();
 }
-inline std::string* JuliaResponse::mutable_rgba_data() {
-  std::string* _s = _internal_mutable_rgba_data();
-  // @@protoc_insertion_point(field_mutable:fractal.JuliaResponse.rgba_data)
-  return _s;
+inline void SessionFrame::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
 }
-inline const std::string& JuliaResponse::_internal_rgba_data() const {
-  return _impl_.rgba_data_.Get();
+inline void SessionFrame::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:fractal.SessionFrame.sequence)
 }
-inline void JuliaResponse::_internal_set_rgba_data(const std::string& value) {
+
+// .fractal.JuliaResponse response = 2;
+inline bool SessionFrame::_internal_has_response() const {
+  return this != internal_default_instance() && _impl_.response_ != nullptr;
+}
+inline bool SessionFrame::has_response() const {
+  return _internal_has_response();
+}
+inline void SessionFrame::clear_response() {
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+}
+inline const ::fractal::JuliaResponse& SessionFrame::_internal_response() const {
+  const ::fractal::JuliaResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fractal::JuliaResponse&>(
+      ::fractal::_JuliaResponse_default_instance_);
+}
+inline const ::fractal::JuliaResponse& SessionFrame::response() const {
+  // @@protoc_insertion_point(field_get:fractal.SessionFrame.response)
+  return _internal_response();
+}
+inline void SessionFrame::unsafe_arena_set_allocated_response(
+    ::fractal::JuliaResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
+  }
+  _impl_.response_ = response;
+  if (response) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fractal.SessionFrame.response)
+}
+inline ::fractal::JuliaResponse* SessionFrame::release_response() {
   
-  _impl_.rgba_data_.Set(value, GetArenaForAllocation());
+  ::fractal::JuliaResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* JuliaResponse::_internal_mutable_rgba_data() {
+inline ::fractal::JuliaResponse* SessionFrame::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_release:fractal.SessionFrame.response)
   
-  return _impl_.rgba_data_.Mutable(GetArenaForAllocation());
+  ::fractal::JuliaResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+  return temp;
 }
-inline std::string* JuliaResponse::release_rgba_data() {
-  // @@protoc_insertion_point(field_release:fractal.JuliaResponse.rgba_data)
-  return _impl_.rgba_data_.Release();
+inline ::fractal::JuliaResponse* SessionFrame::_internal_mutable_response() {
+  
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fractal::JuliaResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
+  }
+  return _impl_.response_;
 }
-inline void JuliaResponse::set_allocated_rgba_data(std::string* rgba_data) {
-  if (rgba_data != nullptr) {
+inline ::fractal::JuliaResponse* SessionFrame::mutable_response() {
+  ::fractal::JuliaResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:fractal.SessionFrame.response)
+  return _msg;
+}
+inline void SessionFrame::set_allocated_response(::fractal::JuliaResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.response_;
+  }
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.rgba_data_.SetAllocated(rgba_data, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.rgba_data_.IsDefault()) {
-    _impl_.rgba_data_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fractal.JuliaResponse.rgba_data)
+  _impl_.response_ = response;
+  // @@protoc_insertion_point(field_set_allocated:fractal.SessionFrame.response)
 }
 
-// double calculation_time_ms = 2;
-inline void JuliaResponse::clear_calculation_time_ms() {
-  _impl_.calculation_time_ms_ = 0;
+// uint32 dropped_updates = 3;
+inline void SessionFrame::clear_dropped_updates() {
+  _impl_.dropped_updates_ = 0u;
 }
-inline double JuliaResponse::_internal_calculation_time_ms() const {
-  return _impl_.calculation_time_ms_;
+inline uint32_t SessionFrame::_internal_dropped_updates() const {
+  return _impl_.dropped_updates_;
 }
-inline double JuliaResponse::calculation_time_ms() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.calculation_time_ms)
-  return _internal_calculation_time_ms();
+inline uint32_t SessionFrame::dropped_updates() const {
+  // @@protoc_insertion_point(field_get:fractal.SessionFrame.dropped_updates)
+  return _internal_dropped_updates();
 }
-inline void JuliaResponse::_internal_set_calculation_time_ms(double value) {
+inline void SessionFrame::_internal_set_dropped_updates(uint32_t value) {
   
-  _impl_.calculation_time_ms_ = value;
+  _impl_.dropped_updates_ = value;
 }
-inline void JuliaResponse::set_calculation_time_ms(double value) {
-  _internal_set_calculation_time_ms(value);
-  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.calculation_time_ms)
+inline void SessionFrame::set_dropped_updates(uint32_t value) {
+  _internal_set_dropped_updates(value);
+  // @@protoc_insertion_point(field_set:fractal.SessionFrame.dropped_updates)
 }
 
-// string server_id = 3;
-inline void JuliaResponse::clear_server_id() {
+// -------------------------------------------------------------------
+
+// ServerStatsRequest
+
+// -------------------------------------------------------------------
+
+// ServerStatsResponse
+
+// string server_id = 1;
+inline void ServerStatsResponse::clear_server_id() {
   _impl_.server_id_.ClearToEmpty();
 }
-inline const std::string& JuliaResponse::server_id() const {
-  // @@protoc_insertion_point(field_get:fractal.JuliaResponse.server_id)
+inline const std::string& ServerStatsResponse::server_id() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.server_id)
   return _internal_server_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void JuliaResponse::set_server_id(ArgT0&& arg0, ArgT... args) {
+void ServerStatsResponse::set_server_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.server_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fractal.JuliaResponse.server_id)
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.server_id)
 }
-inline std::string* JuliaResponse::mutable_server_id() {
+inline std::string* ServerStatsResponse::mutable_server_id() {
   std::string* _s = _internal_mutable_server_id();
-  // @@protoc_insertion_point(field_mutable:fractal.JuliaResponse.server_id)
+  // @@protoc_insertion_point(field_mutable:fractal.ServerStatsResponse.server_id)
   return _s;
 }
-inline const std::string& JuliaResponse::_internal_server_id() const {
+inline const std::string& ServerStatsResponse::_internal_server_id() const {
   return _impl_.server_id_.Get();
 }
-inline void JuliaResponse::_internal_set_server_id(const std::string& value) {
+inline void ServerStatsResponse::_internal_set_server_id(const std::string& value) {
   
   _impl_.server_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* JuliaResponse::_internal_mutable_server_id() {
+inline std::string* ServerStatsResponse::_internal_mutable_server_id() {
   
   return _impl_.server_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* JuliaResponse::release_server_id() {
-  // @@protoc_insertion_point(field_release:fractal.JuliaResponse.server_id)
+inline std::string* ServerStatsResponse::release_server_id() {
+  // @@protoc_insertion_point(field_release:fractal.ServerStatsResponse.server_id)
   return _impl_.server_id_.Release();
 }
-inline void JuliaResponse::set_allocated_server_id(std::string* server_id) {
+inline void ServerStatsResponse::set_allocated_server_id(std::string* server_id) {
   if (server_id != nullptr) {
     
   } else {
@@ -1097,7 +4617,227 @@ inline void JuliaResponse::set_allocated_server_id(std::string* server_id) {
     _impl_.server_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fractal.JuliaResponse.server_id)
+  // @@protoc_insertion_point(field_set_allocated:fractal.ServerStatsResponse.server_id)
+}
+
+// uint64 cache_hits = 2;
+inline void ServerStatsResponse::clear_cache_hits() {
+  _impl_.cache_hits_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_cache_hits() const {
+  return _impl_.cache_hits_;
+}
+inline uint64_t ServerStatsResponse::cache_hits() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.cache_hits)
+  return _internal_cache_hits();
+}
+inline void ServerStatsResponse::_internal_set_cache_hits(uint64_t value) {
+  
+  _impl_.cache_hits_ = value;
+}
+inline void ServerStatsResponse::set_cache_hits(uint64_t value) {
+  _internal_set_cache_hits(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.cache_hits)
+}
+
+// uint64 cache_misses = 3;
+inline void ServerStatsResponse::clear_cache_misses() {
+  _impl_.cache_misses_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_cache_misses() const {
+  return _impl_.cache_misses_;
+}
+inline uint64_t ServerStatsResponse::cache_misses() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.cache_misses)
+  return _internal_cache_misses();
+}
+inline void ServerStatsResponse::_internal_set_cache_misses(uint64_t value) {
+  
+  _impl_.cache_misses_ = value;
+}
+inline void ServerStatsResponse::set_cache_misses(uint64_t value) {
+  _internal_set_cache_misses(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.cache_misses)
+}
+
+// uint64 cache_entries = 4;
+inline void ServerStatsResponse::clear_cache_entries() {
+  _impl_.cache_entries_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_cache_entries() const {
+  return _impl_.cache_entries_;
+}
+inline uint64_t ServerStatsResponse::cache_entries() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.cache_entries)
+  return _internal_cache_entries();
+}
+inline void ServerStatsResponse::_internal_set_cache_entries(uint64_t value) {
+  
+  _impl_.cache_entries_ = value;
+}
+inline void ServerStatsResponse::set_cache_entries(uint64_t value) {
+  _internal_set_cache_entries(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.cache_entries)
+}
+
+// uint64 cache_bytes = 5;
+inline void ServerStatsResponse::clear_cache_bytes() {
+  _impl_.cache_bytes_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_cache_bytes() const {
+  return _impl_.cache_bytes_;
+}
+inline uint64_t ServerStatsResponse::cache_bytes() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.cache_bytes)
+  return _internal_cache_bytes();
+}
+inline void ServerStatsResponse::_internal_set_cache_bytes(uint64_t value) {
+  
+  _impl_.cache_bytes_ = value;
+}
+inline void ServerStatsResponse::set_cache_bytes(uint64_t value) {
+  _internal_set_cache_bytes(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.cache_bytes)
+}
+
+// uint64 cache_capacity = 6;
+inline void ServerStatsResponse::clear_cache_capacity() {
+  _impl_.cache_capacity_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_cache_capacity() const {
+  return _impl_.cache_capacity_;
+}
+inline uint64_t ServerStatsResponse::cache_capacity() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.cache_capacity)
+  return _internal_cache_capacity();
+}
+inline void ServerStatsResponse::_internal_set_cache_capacity(uint64_t value) {
+  
+  _impl_.cache_capacity_ = value;
+}
+inline void ServerStatsResponse::set_cache_capacity(uint64_t value) {
+  _internal_set_cache_capacity(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.cache_capacity)
+}
+
+// uint64 cache_evictions = 7;
+inline void ServerStatsResponse::clear_cache_evictions() {
+  _impl_.cache_evictions_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_cache_evictions() const {
+  return _impl_.cache_evictions_;
+}
+inline uint64_t ServerStatsResponse::cache_evictions() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.cache_evictions)
+  return _internal_cache_evictions();
+}
+inline void ServerStatsResponse::_internal_set_cache_evictions(uint64_t value) {
+  
+  _impl_.cache_evictions_ = value;
+}
+inline void ServerStatsResponse::set_cache_evictions(uint64_t value) {
+  _internal_set_cache_evictions(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.cache_evictions)
+}
+
+// uint64 coalesced_requests = 8;
+inline void ServerStatsResponse::clear_coalesced_requests() {
+  _impl_.coalesced_requests_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_coalesced_requests() const {
+  return _impl_.coalesced_requests_;
+}
+inline uint64_t ServerStatsResponse::coalesced_requests() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.coalesced_requests)
+  return _internal_coalesced_requests();
+}
+inline void ServerStatsResponse::_internal_set_coalesced_requests(uint64_t value) {
+  
+  _impl_.coalesced_requests_ = value;
+}
+inline void ServerStatsResponse::set_coalesced_requests(uint64_t value) {
+  _internal_set_coalesced_requests(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.coalesced_requests)
+}
+
+// uint64 disk_hits = 9;
+inline void ServerStatsResponse::clear_disk_hits() {
+  _impl_.disk_hits_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_disk_hits() const {
+  return _impl_.disk_hits_;
+}
+inline uint64_t ServerStatsResponse::disk_hits() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.disk_hits)
+  return _internal_disk_hits();
+}
+inline void ServerStatsResponse::_internal_set_disk_hits(uint64_t value) {
+  
+  _impl_.disk_hits_ = value;
+}
+inline void ServerStatsResponse::set_disk_hits(uint64_t value) {
+  _internal_set_disk_hits(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.disk_hits)
+}
+
+// uint64 disk_entries = 10;
+inline void ServerStatsResponse::clear_disk_entries() {
+  _impl_.disk_entries_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_disk_entries() const {
+  return _impl_.disk_entries_;
+}
+inline uint64_t ServerStatsResponse::disk_entries() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.disk_entries)
+  return _internal_disk_entries();
+}
+inline void ServerStatsResponse::_internal_set_disk_entries(uint64_t value) {
+  
+  _impl_.disk_entries_ = value;
+}
+inline void ServerStatsResponse::set_disk_entries(uint64_t value) {
+  _internal_set_disk_entries(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.disk_entries)
+}
+
+// uint64 disk_bytes = 11;
+inline void ServerStatsResponse::clear_disk_bytes() {
+  _impl_.disk_bytes_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_disk_bytes() const {
+  return _impl_.disk_bytes_;
+}
+inline uint64_t ServerStatsResponse::disk_bytes() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.disk_bytes)
+  return _internal_disk_bytes();
+}
+inline void ServerStatsResponse::_internal_set_disk_bytes(uint64_t value) {
+  
+  _impl_.disk_bytes_ = value;
+}
+inline void ServerStatsResponse::set_disk_bytes(uint64_t value) {
+  _internal_set_disk_bytes(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.disk_bytes)
+}
+
+// uint64 disk_capacity = 12;
+inline void ServerStatsResponse::clear_disk_capacity() {
+  _impl_.disk_capacity_ = uint64_t{0u};
+}
+inline uint64_t ServerStatsResponse::_internal_disk_capacity() const {
+  return _impl_.disk_capacity_;
+}
+inline uint64_t ServerStatsResponse::disk_capacity() const {
+  // @@protoc_insertion_point(field_get:fractal.ServerStatsResponse.disk_capacity)
+  return _internal_disk_capacity();
+}
+inline void ServerStatsResponse::_internal_set_disk_capacity(uint64_t value) {
+  
+  _impl_.disk_capacity_ = value;
+}
+inline void ServerStatsResponse::set_disk_capacity(uint64_t value) {
+  _internal_set_disk_capacity(value);
+  // @@protoc_insertion_point(field_set:fractal.ServerStatsResponse.disk_capacity)
 }
 
 // -------------------------------------------------------------------
@@ -1167,11 +4907,46 @@ inline void ShutdownResponse::set_allocated_message(std::string* message) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace fractal
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::fractal::FrameEncoding> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::fractal::FrameEncoding>() {
+  return ::fractal::FrameEncoding_descriptor();
+}
+template <> struct is_proto_enum< ::fractal::PixelFormat> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::fractal::PixelFormat>() {
+  return ::fractal::PixelFormat_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -0,0 +1,55 @@
+#ifndef BUFFERPOOL_HPP
+#define BUFFERPOOL_HPP
+
+#include <mutex>
+#include <vector>
+
+// Frame-sized scratch vectors handed back and forth between renders, so a steady stream of requests
+// stops allocating (and page-faulting) fresh buffers for every frame. At most max_free idle buffers
+// are kept; the rest are freed on return.
+template <typename T>
+class BufferPool {
+public:
+    explicit BufferPool(size_t max_free) : maxFree(max_free) {}
+
+    // an empty vector, with the capacity of the largest idle buffer if there is one
+    std::vector<T> take() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (idle.empty()) {
+            return std::vector<T>();
+        }
+        std::vector<T> buffer = std::move(idle.back());
+        idle.pop_back();
+        return buffer;
+    }
+
+    // adds buffers of elements each, written once so their pages are already mapped when a render
+    // takes them (up to max_free buffers in all)
+    void prefill(size_t buffers, size_t elements) {
+        for (size_t i = 0; i < buffers; ++i) {
+            std::vector<T> buffer(elements);
+            give(std::move(buffer));
+        }
+    }
+
+    void give(std::vector<T>&& buffer) {
+        buffer.clear();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (idle.size() >= maxFree || buffer.capacity() == 0) {
+            return;
+        }
+        // kept sorted by capacity so take() hands out the biggest
+        auto it = idle.begin();
+        while (it != idle.end() && it->capacity() < buffer.capacity()) {
+            ++it;
+        }
+        idle.insert(it, std::move(buffer));
+    }
+
+private:
+    size_t maxFree;
+    std::vector<std::vector<T>> idle;
+    std::mutex mutex;
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef CPUBUDGET_HPP
+#define CPUBUDGET_HPP
+
+#include <string>
+
+// How many CPUs this process may actually use. Inside a container hardware_concurrency and
+// omp_get_max_threads report the host's cores, so pools sized from them oversubscribe; this takes
+// the smaller of the affinity mask (cpuset) and the cgroup CPU quota instead.
+class CpuBudget {
+public:
+    // CPUs in this process's affinity mask
+    static int affinityCpus();
+    // cgroup CPU quota rounded up to whole CPUs (cpu.max, or cfs_quota_us on cgroup v1), 0 if unlimited
+    static int quotaCpus();
+    // min(affinity, quota), at least 1, measured once and cached
+    static int threads();
+    // restricts the process to slice index of count equal slices of its current affinity mask, so
+    // replicas sharing a host can be given disjoint cores; call before any threads are started
+    static bool applyPartition(int index, int count);
+    // same, parsed from "index/count" (e.g. FRACTAL_CPU_PARTITION=1/2)
+    static bool applyPartition(const std::string& spec);
+};
+
+#endif
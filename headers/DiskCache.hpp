@@ -0,0 +1,51 @@
+#ifndef DISKCACHE_HPP
+#define DISKCACHE_HPP
+
+#include "ResultCache.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+// Rendered frames persisted in an append-only file that is memory-mapped for reads, so a restarted
+// server finds them again. The file is an 8-byte magic followed by records:
+//   u32 magic, u32 key size, u32 pixels size, i32 encoding, i32 format, u32 crc32(key + pixels), key, pixels
+// Opening scans the records into an index and cuts off a torn tail; when the file would outgrow its
+// capacity it is started over.
+class DiskCache {
+public:
+    struct Stats {
+        uint64_t hits, entries, bytes, capacity;
+    };
+
+    // opens or creates path; the cache stays disabled when the file cannot be opened or locked
+    DiskCache(const std::string& path, size_t capacity_bytes);
+    ~DiskCache();
+    DiskCache(const DiskCache&) = delete;
+    DiskCache& operator=(const DiskCache&) = delete;
+
+    std::shared_ptr<const ResultCache::Frame> get(const std::string& key);
+    void put(const std::string& key, const ResultCache::Frame& frame);
+    Stats stats();
+    bool enabled() const { return map != nullptr; }
+private:
+    struct Entry {
+        uint64_t offset; // of the pixels
+        uint32_t size;
+        int32_t encoding, format;
+    };
+    void scan(uint64_t file_size);
+    void reset();
+
+    int fd;
+    const char* map; // capacity bytes of address space, valid up to end
+    size_t capacity;
+    uint64_t end;
+    std::atomic<uint64_t> hits;
+    std::unordered_map<std::string, Entry> index;
+    std::shared_mutex mutex;
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef FRAMECODEC_HPP
+#define FRAMECODEC_HPP
+
+#include <SFML/Config.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class TileScheduler;
+
+// Packs frames for the wire (see FrameEncoding in fractal.proto for the layout): RGBA or the compact
+// 1- and 2-byte pixel formats. The frame is cut into row bands that are encoded and decoded
+// independently, so both sides work on all cores.
+class FrameCodec {
+public:
+    // same numbers as fractal::FrameEncoding
+    enum Encoding { Raw = 0, Qoi = 1, Deflate = 2, Xrle = 3 };
+
+    // replaces out with the encoded frame and returns the encoding used: QOI only packs RGBA, other
+    // pixel sizes get Deflate instead. Bands run on pool when one is given, otherwise on OpenMP
+    static Encoding encode(const sf::Uint8* pixels, unsigned int width, unsigned int height,
+        unsigned int bytes_per_pixel, Encoding encoding, std::string& out, TileScheduler* pool = nullptr);
+    // fills pixels (width * height * bytes_per_pixel bytes) from an encoded frame; false if the data does not decode
+    static bool decode(const char* data, size_t size, unsigned int width, unsigned int height,
+        unsigned int bytes_per_pixel, Encoding encoding, sf::Uint8* pixels);
+
+    // Delta frames for streams: pixels XORed with previous, the frame sent before it (same size and
+    // format). Only the changed bytes go out as Xrle, or with Deflate the whole XOR frame is deflated,
+    // which wins when most bytes change a little. Returns the encoding used
+    static Encoding encodeDelta(const sf::Uint8* pixels, const sf::Uint8* previous, unsigned int width,
+        unsigned int height, unsigned int bytes_per_pixel, Encoding encoding, std::string& out,
+        TileScheduler* pool = nullptr);
+    // turns pixels, which holds the previous frame, into the new one in place; false if the data does not decode
+    static bool applyDelta(const char* data, size_t size, unsigned int width, unsigned int height,
+        unsigned int bytes_per_pixel, Encoding encoding, sf::Uint8* pixels);
+
+private:
+    // band table: u32 band count, u32 band rows, u32 size of each band, then the bands
+    static void join_bands(const std::vector<std::string>& bands, std::string& out);
+    static bool split_bands(const char* data, size_t size, unsigned int height, sf::Uint32& band_rows,
+        std::vector<size_t>& offsets);
+};
+
+#endif
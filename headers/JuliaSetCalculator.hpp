@@ -4,19 +4,49 @@
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <complex>
+#include <vector>
 
 class JuliaSetCalculator {
 public:
-    JuliaSetCalculator(int theme = 1) : Theme(theme) {};
+    JuliaSetCalculator(int theme = 1) : Theme(theme), Blur(true) {};
     virtual double calculate_polynomial (sf::Image& image, const std::complex<double>& c_constant, 
         int max_iterations, int poly_degree,
         double view_x_min, double view_x_max, double view_y_min, double view_y_max) = 0;
     void setTheme(int theme);
     int getTheme() const { return Theme; }
+    // colour of every iteration count 0..max_iterations under the current theme (or the given one, 1-4)
+    std::vector<sf::Color> buildPalette(int max_iterations);
+    std::vector<sf::Color> buildPalette(int max_iterations, int theme);
+    // 5-point blur applied after colouring, on by default in every engine
+    void setBlur(bool enabled);
+    bool getBlur() const { return Blur; }
+    // fused colorize + blur of a whole frame of iteration counts into RGBA, band by band with rolling rows
+    void post_process(const sf::Uint16* iterations, unsigned int width, unsigned int height,
+        int max_iterations, sf::Uint8* rgba, int threads);
+    void post_process(const sf::Uint8* iterations, unsigned int width, unsigned int height,
+        int max_iterations, sf::Uint8* rgba, int threads);
+    // the same pass split into independent bands of post_process_band_rows() rows, for callers that
+    // schedule the work themselves; palette comes from buildPackedPalette
+    std::vector<sf::Uint32> buildPackedPalette(int max_iterations);
+    std::vector<sf::Uint32> buildPackedPalette(int max_iterations, int theme);
+    static int post_process_bands(unsigned int height);
+    static unsigned int post_process_band_rows();
+    void post_process_band(const sf::Uint16* iterations, unsigned int width, unsigned int height,
+        const std::vector<sf::Uint32>& palette, sf::Uint8* rgba, int band);
+    // the same for a window of the frame: only rows [first_row, last_row) of band are written, iterations
+    // holds the frame from row counts_row on (the blur reads one row either side) and rgba from first_row on
+    void post_process_band(const sf::Uint16* iterations, unsigned int width, unsigned int height,
+        const std::vector<sf::Uint32>& palette, sf::Uint8* rgba, int band,
+        unsigned int counts_row, unsigned int first_row, unsigned int last_row);
 protected:
     int Theme; 
+    bool Blur;
     double map(double value, double in_min, double in_max, double out_min, double out_max);
     sf::Color PixelArtist(int n, int max_iterations);
+    sf::Color PixelArtist(int n, int max_iterations, int theme);
+    // blurs bytes of pixels [x_begin, x_end) of row into out, leaving alpha alone; out must not alias the inputs
+    static void blur_row(const sf::Uint8* above, const sf::Uint8* row, const sf::Uint8* below, sf::Uint8* out,
+        int x_begin, int x_end);
 };
 
 #endif
\ No newline at end of file
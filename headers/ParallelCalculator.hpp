@@ -4,12 +4,53 @@
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include "JuliaSetCalculator.hpp"
+#include "TileScheduler.hpp"
+#include <atomic>
+#include <chrono>
 #include <complex>
 #include <string>
+#include <vector>
+#include <mpi.h>
+
+// one frame of a ParallelCalculator::calculate_batch call; image must already have its size
+struct FrameJob {
+    // receives the coloured frame; may be nullptr, see pixels
+    sf::Image* image;
+    std::complex<double> c_constant;
+    int max_iterations;
+    int poly_degree;
+    double view_x_min, view_x_max, view_y_min, view_y_max;
+    // theme 1-4 for this frame, 0 for the calculator's own
+    int theme = 0;
+    // when set, the escape counts are computed here (reusing its capacity) and left in it
+    std::vector<sf::Uint16>* counts = nullptr;
+    // without an image: the coloured frame goes straight to pixels (width * height * 4 bytes), and with
+    // no pixels either the frame is not coloured at all
+    sf::Uint8* pixels = nullptr;
+    unsigned int width = 0, height = 0;
+    // once this turns true the frame's remaining tiles are skipped and its output is left incomplete
+    const std::atomic<bool>* cancel = nullptr;
+    // only rows [first_row, first_row + rows) of the frame when rows > 0 (frames without an image): pixels
+    // then holds just those rows, and counts those plus the row either side that the blur reads when the
+    // frame is coloured
+    unsigned int first_row = 0, rows = 0;
+    // progressive passes: with step > 1 only every step-th pixel of every step-th row is computed and the
+    // rest of counts is left alone; pixels on the grid of done_step (an earlier, coarser pass) are skipped
+    unsigned int step = 1, done_step = 0;
+    // like cancel: the frame stops at its next row once this has passed
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+    // cancelled or past its deadline, so its output may be incomplete
+    bool stopped() const {
+        return (cancel && cancel->load(std::memory_order_relaxed)) ||
+               (deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() > deadline);
+    }
+};
 
 class ParallelCalculator:public JuliaSetCalculator {
 public:
     ParallelCalculator();
+    ~ParallelCalculator();
     double calculate_polynomial (sf::Image& image, const std::complex<double>& c_constant, 
         int max_iterations, int poly_degree,
         double view_x_min, double view_x_max, double view_y_min, double view_y_max);
@@ -18,20 +59,96 @@ public:
         const std::complex<double>& c_constant,
         int max_iterations, int poly_degree,
         double view_x_min, double view_x_max, double view_y_min, double view_y_max);
+
+    // renders several frames at once, their tiles forming a single job on the tile scheduler (or one
+    // OpenMP loop without it); returns the time for the whole batch
+    double calculate_batch(std::vector<FrameJob>& frames);
+    // escape times on a grid of samples x samples pixels of the frame, scaled up to its size: the
+    // iterations a render of it will cost, for a few hundred pixels' worth of work
+    double estimate_iterations(const FrameJob& frame, unsigned int samples = 16);
+
+    // every rank renders its band and writes it straight into a shared "ppm" (RGB) or "raw" (RGBA) file
+    // with collective MPI-IO, so the frame never has to fit in one rank's memory
+    double render_to_file(int rank, int n_ranks, unsigned int width, unsigned int height,
+        const std::string& path, const std::string& format,
+        const std::complex<double>& c_constant,
+        int max_iterations, int poly_degree,
+        double view_x_min, double view_x_max, double view_y_min, double view_y_max);
+
+    // frame farm for animations: ranks claim frames_per_claim frames at a time from a shared counter,
+    // render each one with OpenMP and save it as <output_dir>/frame_NNNNN.<extension>
+    int render_frames(int rank, const std::vector<std::complex<double>>& c_values,
+        unsigned int width, unsigned int height,
+        const std::string& output_dir, const std::string& extension, int frames_per_claim,
+        int max_iterations, int poly_degree,
+        double view_x_min, double view_x_max, double view_y_min, double view_y_max);
     
     void setSchedule(const std::string& schedule);
     std::string getSchedule() const;
     void setNumThreads(int threads);
     int getNumThreads() const;
+    // when set, calculate_polynomial runs its tiles on this process-wide pool instead of an OpenMP team
+    // (the schedule and thread count are then ignored); the scheduler must outlive the calculator
+    void setScheduler(TileScheduler* shared);
+    TileScheduler* getScheduler() const;
+    // calculate_distributed runs one of the next three modes, in this order of precedence: the shared-memory
+    // frame if enabled, else a compact gather if the format asks for one, else the decomposition. Settings
+    // of a mode that is not run have no effect; rank 0 warns about them once and they revert to the default.
+
+    // ranks sharing a node render into one MPI shared-memory frame, only node leaders gather
+    void setSharedMemory(bool enabled);
+    bool getSharedMemory() const;
+    // "rgba" (default), "iter16" or "palette8": what the row split sends to rank 0 in calculate_distributed;
+    // palette8 needs max_iterations <= 255 and sends 16-bit counts otherwise
+    void setGatherFormat(const std::string& format);
+    std::string getGatherFormat() const;
+    // "rows" (default) splits the frame into bands, "cart" into a 2D MPI_Cart_create grid of blocks,
+    // "auto" picks whichever grid needs the least halo for the image's aspect ratio
+    void setDecomposition(const std::string& mode);
+    std::string getDecomposition() const;
 private:
     std::string scheduleType;
     int numThreads;
+    TileScheduler* scheduler;
+    bool sharedMemory;
+    std::string gatherFormat;
+    std::string decomposition;
 
-    void calculate_pixel(unsigned int px, unsigned int py, sf::Image& image, const std::complex<double>& c_constant, 
+    // shared-memory frame state, kept between frames so the window is not reallocated every call
+    MPI_Comm nodeComm;
+    MPI_Comm leaderComm;
+    MPI_Win frameWindow;
+    sf::Uint8* frameBase;
+    size_t frameWindowBytes;
+
+    int escape_time(double x0, double y0, const std::complex<double>& c_constant, int max_iterations, int poly_degree);
+    void calculate_pixel(unsigned int px, unsigned int py, unsigned int width, unsigned int height,
+        sf::Uint16* iterations, const std::complex<double>& c_constant, 
         int max_iterations, int poly_degree,
         double view_x_min, double view_x_max, double view_y_min, double view_y_max);
-    void apply_blur(std::vector<sf::Uint8>& buffer, int width, int start_row, int end_row);  
-    
+    void calculate_row(unsigned int py, unsigned int x_begin, unsigned int x_end,
+        unsigned int width, unsigned int height, sf::Uint8* row,
+        const std::complex<double>& c_constant, int max_iterations, int poly_degree,
+        double view_x_min, double view_x_max, double view_y_min, double view_y_max);
+    void apply_blur(std::vector<sf::Uint8>& buffer, int width, int start_row, int end_row,
+        int start_col = 1, int end_col = -1);
+    void apply_blur(sf::Uint8* rows, int width, int count, const sf::Uint8* above, const sf::Uint8* below,
+        int start_col = 1, int end_col = -1);
+    void calculate_distributed_shared(int rank, int n_ranks, sf::Image& image,
+        const std::complex<double>& c_constant,
+        int max_iterations, int poly_degree,
+        double view_x_min, double view_x_max, double view_y_min, double view_y_max);
+    void calculate_distributed_compact(int rank, int n_ranks, sf::Image& image,
+        const std::complex<double>& c_constant,
+        int max_iterations, int poly_degree,
+        double view_x_min, double view_x_max, double view_y_min, double view_y_max);
+    void calculate_distributed_cart(int rank, int n_ranks, sf::Image& image,
+        unsigned int width, unsigned int height, const int dims[2],
+        const std::complex<double>& c_constant,
+        int max_iterations, int poly_degree,
+        double view_x_min, double view_x_max, double view_y_min, double view_y_max);
+    static void choose_grid(int n_ranks, unsigned int width, unsigned int height, int dims[2]);
+    void releaseSharedWindow();
 };
 
-#endif
\ No newline at end of file
+#endif
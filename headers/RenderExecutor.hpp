@@ -0,0 +1,38 @@
+#ifndef RENDEREXECUTOR_HPP
+#define RENDEREXECUTOR_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of render threads fed from a bounded FIFO. gRPC callbacks only queue work here,
+// so transport threads go straight back to reading the next request.
+class RenderExecutor {
+public:
+    RenderExecutor(int workers, size_t max_queue);
+    ~RenderExecutor();
+    // queues job, or returns false straight away when the queue is full or the executor is stopping
+    bool submit(std::function<void()> job);
+    // stops taking work, finishes everything already queued and joins the workers
+    void shutdown();
+    size_t queued();
+    // nothing is queued and at least one worker is waiting for work
+    bool idle();
+    int getWorkers() const { return static_cast<int>(threads.size()); }
+    size_t getMaxQueue() const { return maxQueue; }
+private:
+    void worker_loop();
+
+    size_t maxQueue;
+    bool stopping;
+    size_t busy;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::vector<std::thread> threads;
+};
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef REQUESTBATCHER_HPP
+#define REQUESTBATCHER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Collects items that arrive within a short window and hands them to flush() together. A batch is
+// closed when the window after its first item runs out or when it reaches max_batch items, and at
+// once when idle() says there is nothing for it to wait behind, so an idle server adds no latency.
+// flush() runs on the batcher's own thread and should only hand the batch on, not render it.
+template <typename Item>
+class RequestBatcher {
+public:
+    RequestBatcher(std::chrono::microseconds window, size_t max_batch,
+        std::function<void(std::vector<Item>&&)> flush, std::function<bool()> idle = nullptr)
+        : window(window), maxBatch(max_batch > 0 ? max_batch : 1), flush(std::move(flush)), idle(std::move(idle)),
+          stopping(false), thread(&RequestBatcher::loop, this) {}
+
+    ~RequestBatcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        arrived.notify_all();
+        thread.join();
+    }
+
+    void add(Item item) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back(std::move(item));
+        }
+        arrived.notify_all();
+    }
+
+private:
+    void loop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            arrived.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty()) {
+                return;
+            }
+            if (!idle || !idle()) {
+                auto deadline = std::chrono::steady_clock::now() + window;
+                arrived.wait_until(lock, deadline, [this] { return stopping || pending.size() >= maxBatch; });
+            }
+
+            std::vector<Item> batch;
+            if (pending.size() > maxBatch) {
+                batch.assign(std::make_move_iterator(pending.begin()), std::make_move_iterator(pending.begin() + maxBatch));
+                pending.erase(pending.begin(), pending.begin() + maxBatch);
+            } else {
+                batch.swap(pending);
+            }
+            lock.unlock();
+            flush(std::move(batch));
+            lock.lock();
+        }
+    }
+
+    std::chrono::microseconds window;
+    size_t maxBatch;
+    std::function<void(std::vector<Item>&&)> flush;
+    std::function<bool()> idle;
+    bool stopping;
+    std::vector<Item> pending;
+    std::mutex mutex;
+    std::condition_variable arrived;
+    std::thread thread;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef RESULTCACHE_HPP
+#define RESULTCACHE_HPP
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Finished frames keyed by their render parameters, least recently used dropped first once the
+// cached bytes exceed the capacity. Frames are shared read-only, so a hit is a lookup and a copy.
+class ResultCache {
+public:
+    struct Frame {
+        std::string pixels; // encoded bytes exactly as they go on the wire
+        int encoding;
+        int format;
+    };
+    struct Stats {
+        uint64_t hits, misses, evictions;
+        uint64_t entries, bytes, capacity;
+    };
+
+    explicit ResultCache(size_t capacity_bytes);
+    // the cached frame for key, or nullptr (counted as a miss)
+    std::shared_ptr<const Frame> get(const std::string& key);
+    // caches frame under key, replacing an older one; frames larger than the capacity are not kept
+    void put(const std::string& key, std::shared_ptr<const Frame> frame);
+    Stats stats();
+    bool enabled() const { return capacity > 0; }
+
+    // key builders: values are appended as raw bytes, doubles rounded to 40 significant bits with
+    // -0 folded into 0, so coordinates that differ only by float noise share one entry
+    static void appendKey(std::string& key, double value);
+    static void appendKey(std::string& key, int64_t value);
+private:
+    typedef std::list<std::pair<std::string, std::shared_ptr<const Frame>>> LruList;
+    static size_t cost(const std::string& key, const Frame& frame);
+    void evict_to(size_t budget);
+
+    size_t capacity;
+    size_t bytes;
+    uint64_t hits, misses, evictions;
+    LruList lru; // most recently used first
+    std::unordered_map<std::string, LruList::iterator> index;
+    std::mutex mutex;
+};
+
+#endif
@@ -5,8 +5,14 @@
 #include "JuliaSetCalculator.hpp"
 #include "SequentialCalculator.hpp"
 #include "ParallelCalculator.hpp"
+#include "SharedFrameRing.hpp"
 #include <string>
 #include <complex>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "fractal.grpc.pb.h"
 
 enum class CalcMode
@@ -22,6 +28,8 @@ public:
     SFMLWindowDrawer(unsigned int width, unsigned int height, const std::string &title, std::unique_ptr<fractal::FractalService::Stub> stub);
     ~SFMLWindowDrawer();
     void run();
+    // the servers run on this host: have them leave frames in their shared frame rings
+    void setSharedMemory(bool enabled) { sharedMemory = enabled; }
 
 private:
     std::unique_ptr<fractal::FractalService::Stub> stub_;
@@ -30,6 +38,16 @@ private:
     void render();
 
     void recalculateFractal();
+    void showFrame(const fractal::JuliaResponse &response, unsigned int width, unsigned int height,
+                   int max_iterations, double latency_ms);
+    void logMetrics(bool ok, double latency_ms);
+    // InteractiveSession stream: states go out from recalculateFractal, frames come back on a reader thread
+    bool sendSessionUpdate(const fractal::JuliaRequest &request);
+    void readSession();
+    void presentSessionFrame();
+    void closeSession();
+    // colours frameCounts with the current theme into the displayed texture
+    void colorizeFrame();
 
     void setupUI();
     void updateUI();
@@ -40,6 +58,30 @@ private:
     sf::Image fractalImage;
     sf::Texture fractalTexture;
     sf::Sprite fractalSprite;
+    // escape counts of the last frame from the server, kept so a theme switch needs no new request
+    std::vector<sf::Uint16> frameCounts;
+    unsigned int frameWidth, frameHeight;
+    int frameMaxIterations;
+
+    struct SentUpdate
+    {
+        uint64_t sequence;
+        unsigned int width, height;
+        int max_iterations;
+        std::chrono::steady_clock::time_point sent;
+    };
+    std::unique_ptr<grpc::ClientContext> sessionContext;
+    std::unique_ptr<grpc::ClientReaderWriterInterface<fractal::SessionUpdate, fractal::SessionFrame>> session;
+    std::thread sessionReader;
+    std::mutex sessionMutex;             // guards the three fields below, shared with the reader thread
+    fractal::SessionFrame sessionFrame;  // newest frame received and not shown yet
+    bool sessionFrameReady = false;
+    bool sessionBroken = false;
+    uint64_t sessionSequence = 0;
+    std::deque<SentUpdate> sessionSent;  // states sent and not answered yet, oldest first
+
+    bool sharedMemory = false;
+    std::unique_ptr<SharedFrameRing> sharedRing; // the ring the last shared frame came from
 
     SequentialCalculator *sequentialCalc;
     ParallelCalculator *parallelCalc;
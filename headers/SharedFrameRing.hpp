@@ -0,0 +1,48 @@
+#ifndef SHAREDFRAMERING_HPP
+#define SHAREDFRAMERING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+// Frames handed to clients on the same host through a POSIX shared-memory object instead of the RPC.
+// The object is a 64-byte header followed by a ring of capacity bytes:
+//   u64 magic, u64 capacity, u64 instance, u64 reserved
+// A frame at logical position p lives at 64 + p % capacity and never wraps. The server raises reserved
+// before it overwrites anything, so a reader that still finds reserved - p <= capacity after using a
+// frame knows it read it intact. instance tells a restarted server's object from the one it replaced.
+class SharedFrameRing {
+public:
+    // creates the object name (replacing a stale one) with a ring of capacity_bytes, for the server;
+    // the ring stays disabled when it cannot be created
+    SharedFrameRing(const std::string& name, size_t capacity_bytes);
+    // maps the existing object name read-only, for a client
+    explicit SharedFrameRing(const std::string& name);
+    ~SharedFrameRing();
+    SharedFrameRing(const SharedFrameRing&) = delete;
+    SharedFrameRing& operator=(const SharedFrameRing&) = delete;
+
+    // copies the frame in and returns its position; false when it is larger than the ring
+    bool put(const char* data, size_t size, uint64_t& position);
+    // the size bytes at position, in place, or nullptr if they are gone; check intact() when done with them
+    const char* at(uint64_t position, size_t size) const;
+    bool intact(uint64_t position) const;
+
+    bool enabled() const { return map != nullptr; }
+    const std::string& getName() const { return name; }
+    uint64_t getInstance() const;
+private:
+    struct Header;
+    Header* header() const;
+
+    std::string name;
+    bool owner;
+    char* map;
+    size_t capacity;
+    size_t mapped;
+    uint64_t head; // logical end of the last frame put
+    std::mutex mutex;
+};
+
+#endif
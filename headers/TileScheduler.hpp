@@ -0,0 +1,43 @@
+#ifndef TILESCHEDULER_HPP
+#define TILESCHEDULER_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// One fixed pool of compute threads shared by every request in the process. Each run() is a job of
+// independent tiles; workers take one tile at a time from the in-flight jobs in round-robin order,
+// so concurrent frames share the cores fairly instead of each opening its own OpenMP team.
+class TileScheduler {
+public:
+    // with pin_threads, worker i is bound to the i-th CPU of the process's affinity mask (only when
+    // there are at least as many CPUs as workers), so tiles stop migrating between cores
+    explicit TileScheduler(int workers, bool pin_threads = false);
+    ~TileScheduler();
+    // runs task(0) .. task(n_tiles - 1) on the pool and returns when all of them are done
+    void run(int n_tiles, const std::function<void(int)>& task);
+    int getWorkers() const { return static_cast<int>(threads.size()); }
+    bool isPinned() const { return pinned; }
+private:
+    struct Job {
+        const std::function<void(int)>* task;
+        int total;
+        int next;
+        int done;
+    };
+
+    void worker_loop();
+
+    bool stopping;
+    bool pinned;
+    std::vector<Job*> active;
+    size_t cursor;
+    std::mutex mutex;
+    std::condition_variable work;
+    std::condition_variable finished;
+    std::vector<std::thread> threads;
+};
+
+#endif
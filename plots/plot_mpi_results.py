@@ -12,13 +12,18 @@ def plot_mpi_results(csv_path, prefix):
         print(f"{csv_path} not found.")
         return
     df = pd.read_csv(csv_path)
-    sizes = df["ImageSize"].unique()
+    if "Mode" not in df.columns:
+        df["Mode"] = "rgba/rows"  # rows written before the mode was recorded
+    # one line per image size and MPI mode; the mode only shows in the label when runs mix modes
+    series = df.groupby(["ImageSize", "Mode"], sort=False)
+    show_mode = df["Mode"].nunique() > 1
+    label = lambda s, m: f"{s}x{s} {m}" if show_mode else f"{s}x{s}"
 
     # Speedup plot
     plt.figure(figsize=(8,5))
-    for s in sizes:
-        sub = df[df["ImageSize"] == s].sort_values("Threads")
-        plt.plot(sub["Threads"], sub["Speedup"], 'o-', label=f"{s}x{s}")
+    for (s, m), sub in series:
+        sub = sub.sort_values("Threads")
+        plt.plot(sub["Threads"], sub["Speedup"], 'o-', label=label(s, m))
     max_ranks = df["Threads"].max()
     plt.plot([1, max_ranks], [1, max_ranks], 'k--', label="Ideal")
     plt.title(f"MPI Speedup ({prefix})")
@@ -30,9 +35,9 @@ def plot_mpi_results(csv_path, prefix):
 
     # Efficiency plot
     plt.figure(figsize=(8,5))
-    for s in sizes:
-        sub = df[df["ImageSize"] == s].sort_values("Threads")
-        plt.plot(sub["Threads"], sub["Efficiency"], 'o-', label=f"{s}x{s}")
+    for (s, m), sub in series:
+        sub = sub.sort_values("Threads")
+        plt.plot(sub["Threads"], sub["Efficiency"], 'o-', label=label(s, m))
     plt.title(f"MPI Efficiency ({prefix})")
     plt.xlabel("Ranks")
     plt.ylabel("Efficiency (%)")
@@ -42,9 +47,9 @@ def plot_mpi_results(csv_path, prefix):
 
     # Execution time plot
     plt.figure(figsize=(8,5))
-    for s in sizes:
-        sub = df[df["ImageSize"] == s].sort_values("Threads")
-        plt.plot(sub["Threads"], sub["Parallel"], 'o-', label=f"{s}x{s}")
+    for (s, m), sub in series:
+        sub = sub.sort_values("Threads")
+        plt.plot(sub["Threads"], sub["Parallel"], 'o-', label=label(s, m))
     plt.title(f"MPI Execution Time ({prefix})")
     plt.xlabel("Ranks")
     plt.ylabel("Time (s)")
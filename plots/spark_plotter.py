@@ -5,7 +5,12 @@ import os
 
 def load_metrics(csv_path: str) -> pd.DataFrame:
     df = pd.read_csv(csv_path)
+    # latency_ms covers frames sent in a call of their own; frames streamed back from a batch call record
+    # batch_elapsed_ms instead (older metrics files have no such column and only single calls)
     df['latency_ms'] = df['latency_ms'].astype(float)
+    if 'batch_elapsed_ms' not in df:
+        df['batch_elapsed_ms'] = float('nan')
+    df['batch_elapsed_ms'] = df['batch_elapsed_ms'].astype(float)
     df['calc_time_ms'] = df['calc_time_ms'].astype(float)
     df['success'] = df['success'].astype(int)
     return df
@@ -17,18 +22,33 @@ def plot_metrics(df: pd.DataFrame, output_dir: str):
     
     fig, ax = plt.subplots(figsize=(12, 5))
     for i, worker in enumerate(workers):
-        worker_df = df[df['worker'] == worker].sort_values('frame_id')
+        worker_df = df[df['worker'] == worker].dropna(subset=['latency_ms']).sort_values('frame_id')
         ax.plot(worker_df['frame_id'], worker_df['latency_ms'], 
                 marker='o', markersize=4, label=worker, color=colors[i % len(colors)])
     ax.set_xlabel('Frame ID')
     ax.set_ylabel('Latency (ms)')
-    ax.set_title('Round-Trip Latency per Frame (by Worker)')
+    ax.set_title('Round-Trip Latency per Frame, Single Calls (by Worker)')
     ax.legend(title='Worker')
     ax.grid(True, alpha=0.3)
     plt.tight_layout()
     plt.savefig(f'{output_dir}/latency_per_frame.png', dpi=150)
     plt.close()
     
+    if df['batch_elapsed_ms'].notna().any():
+        fig, ax = plt.subplots(figsize=(12, 5))
+        for i, worker in enumerate(workers):
+            worker_df = df[df['worker'] == worker].dropna(subset=['batch_elapsed_ms']).sort_values('frame_id')
+            ax.plot(worker_df['frame_id'], worker_df['batch_elapsed_ms'], 
+                    marker='o', markersize=4, label=worker, color=colors[i % len(colors)])
+        ax.set_xlabel('Frame ID')
+        ax.set_ylabel('Time Since Batch Call Started (ms)')
+        ax.set_title('Arrival of Batched Frames (by Worker)')
+        ax.legend(title='Worker')
+        ax.grid(True, alpha=0.3)
+        plt.tight_layout()
+        plt.savefig(f'{output_dir}/batch_elapsed_per_frame.png', dpi=150)
+        plt.close()
+    
     fig, ax = plt.subplots(figsize=(12, 5))
     for i, worker in enumerate(workers):
         worker_df = df[df['worker'] == worker].sort_values('frame_id')
@@ -24,21 +24,45 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rfractal.proto\x12\x07\x66ractal\"\xb6\x01\n\x0cJuliaRequest\x12\x0e\n\x06\x63_real\x18\x01 \x01(\x01\x12\x0e\n\x06\x63_imag\x18\x02 \x01(\x01\x12\r\n\x05width\x18\x03 \x01(\x05\x12\x0e\n\x06height\x18\x04 \x01(\x05\x12\x16\n\x0emax_iterations\x18\x05 \x01(\x05\x12\x13\n\x0bpoly_degree\x18\x06 \x01(\x05\x12\r\n\x05x_min\x18\x07 \x01(\x01\x12\r\n\x05x_max\x18\x08 \x01(\x01\x12\r\n\x05y_min\x18\t \x01(\x01\x12\r\n\x05y_max\x18\n \x01(\x01\"R\n\rJuliaResponse\x12\x11\n\trgba_data\x18\x01 \x01(\x0c\x12\x1b\n\x13\x63\x61lculation_time_ms\x18\x02 \x01(\x01\x12\x11\n\tserver_id\x18\x03 \x01(\t\"\x11\n\x0fShutdownRequest\"#\n\x10ShutdownResponse\x12\x0f\n\x07message\x18\x01 \x01(\t2\x92\x01\n\x0e\x46ractalService\x12?\n\x0e\x43\x61lculateJulia\x12\x15.fractal.JuliaRequest\x1a\x16.fractal.JuliaResponse\x12?\n\x08Shutdown\x12\x18.fractal.ShutdownRequest\x1a\x19.fractal.ShutdownResponseb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rfractal.proto\x12\x07\x66ractal\"\xc1\x02\n\x0cJuliaRequest\x12\x0e\n\x06\x63_real\x18\x01 \x01(\x01\x12\x0e\n\x06\x63_imag\x18\x02 \x01(\x01\x12\r\n\x05width\x18\x03 \x01(\x05\x12\x0e\n\x06height\x18\x04 \x01(\x05\x12\x16\n\x0emax_iterations\x18\x05 \x01(\x05\x12\x13\n\x0bpoly_degree\x18\x06 \x01(\x05\x12\r\n\x05x_min\x18\x07 \x01(\x01\x12\r\n\x05x_max\x18\x08 \x01(\x01\x12\r\n\x05y_min\x18\t \x01(\x01\x12\r\n\x05y_max\x18\n \x01(\x01\x12(\n\x08\x65ncoding\x18\x0b \x01(\x0e\x32\x16.fractal.FrameEncoding\x12$\n\x06\x66ormat\x18\x0c \x01(\x0e\x32\x14.fractal.PixelFormat\x12\r\n\x05theme\x18\r \x01(\x05\x12\x13\n\x0bprogressive\x18\x0e \x01(\x08\x12\x15\n\rshared_memory\x18\x0f \x01(\x08\"M\n\x0bSharedFrame\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08instance\x18\x02 \x01(\x04\x12\x10\n\x08position\x18\x03 \x01(\x04\x12\x0c\n\x04size\x18\x04 \x01(\x04\"\xe6\x01\n\rJuliaResponse\x12\x11\n\trgba_data\x18\x01 \x01(\x0c\x12\x1b\n\x13\x63\x61lculation_time_ms\x18\x02 \x01(\x01\x12\x11\n\tserver_id\x18\x03 \x01(\t\x12(\n\x08\x65ncoding\x18\x04 \x01(\x0e\x32\x16.fractal.FrameEncoding\x12$\n\x06\x66ormat\x18\x05 \x01(\x0e\x32\x14.fractal.PixelFormat\x12\r\n\x05scale\x18\x06 \x01(\x05\x12\r\n\x05\x64\x65lta\x18\x07 \x01(\x08\x12$\n\x06shared\x18\x08 \x01(\x0b\x32\x14.fractal.SharedFrame\"<\n\x11JuliaBatchRequest\x12\'\n\x08requests\x18\x01 \x03(\x0b\x32\x15.fractal.JuliaRequest\"M\n\x12JuliaBatchResponse\x12\r\n\x05index\x18\x01 \x01(\x05\x12(\n\x08response\x18\x02 \x01(\x0b\x32\x16.fractal.JuliaResponse\"\xbb\x01\n\nFrameChunk\x12\x11\n\tfirst_row\x18\x01 \x01(\x05\x12\x0c\n\x04rows\x18\x02 \x01(\x05\x12\x0c\n\x04\x64\x61ta\x18\x03 \x01(\x0c\x12(\n\x08\x65ncoding\x18\x04 \x01(\x0e\x32\x16.fractal.FrameEncoding\x12$\n\x06\x66ormat\x18\x05 \x01(\x0e\x32\x14.fractal.PixelFormat\x12\x1b\n\x13\x63\x61lculation_time_ms\x18\x06 \x01(\x01\x12\x11\n\tserver_id\x18\x07 \x01(\t\"\xb7\x01\n\x11TrajectoryRequest\x12$\n\x05\x66rame\x18\x01 \x01(\x0b\x32\x15.fractal.JuliaRequest\x12\x11\n\tstep_real\x18\x02 \x01(\x01\x12\x11\n\tstep_imag\x18\x03 \x01(\x01\x12\x13\n\x0b\x66rame_count\x18\x04 \x01(\x05\x12\x13\n\x0b\x66irst_frame\x18\x05 \x01(\x05\x12\x11\n\tlookahead\x18\x06 \x01(\x05\x12\x19\n\x11keyframe_interval\x18\x07 \x01(\x05\"p\n\x0fTrajectoryFrame\x12\x13\n\x0b\x66rame_index\x18\x01 \x01(\x05\x12\x0e\n\x06\x63_real\x18\x02 \x01(\x01\x12\x0e\n\x06\x63_imag\x18\x03 \x01(\x01\x12(\n\x08response\x18\x04 \x01(\x0b\x32\x16.fractal.JuliaResponse\"G\n\rSessionUpdate\x12\x10\n\x08sequence\x18\x01 \x01(\x04\x12$\n\x05\x66rame\x18\x02 \x01(\x0b\x32\x15.fractal.JuliaRequest\"c\n\x0cSessionFrame\x12\x10\n\x08sequence\x18\x01 \x01(\x04\x12(\n\x08response\x18\x02 \x01(\x0b\x32\x16.fractal.JuliaResponse\x12\x17\n\x0f\x64ropped_updates\x18\x03 \x01(\r\"\x14\n\x12ServerStatsRequest\"\x9f\x02\n\x13ServerStatsResponse\x12\x11\n\tserver_id\x18\x01 \x01(\t\x12\x12\n\ncache_hits\x18\x02 \x01(\x04\x12\x14\n\x0c\x63\x61\x63he_misses\x18\x03 \x01(\x04\x12\x15\n\rcache_entries\x18\x04 \x01(\x04\x12\x13\n\x0b\x63\x61\x63he_bytes\x18\x05 \x01(\x04\x12\x16\n\x0e\x63\x61\x63he_capacity\x18\x06 \x01(\x04\x12\x17\n\x0f\x63\x61\x63he_evictions\x18\x07 \x01(\x04\x12\x1a\n\x12\x63oalesced_requests\x18\x08 \x01(\x04\x12\x11\n\tdisk_hits\x18\t \x01(\x04\x12\x14\n\x0c\x64isk_entries\x18\n \x01(\x04\x12\x12\n\ndisk_bytes\x18\x0b \x01(\x04\x12\x15\n\rdisk_capacity\x18\x0c \x01(\x04\"\x11\n\x0fShutdownRequest\"#\n\x10ShutdownResponse\x12\x0f\n\x07message\x18\x01 \x01(\t*8\n\rFrameEncoding\x12\x07\n\x03RAW\x10\x00\x12\x07\n\x03QOI\x10\x01\x12\x0b\n\x07\x44\x45\x46LATE\x10\x02\x12\x08\n\x04XRLE\x10\x03*2\n\x0bPixelFormat\x12\t\n\x05RGBA8\x10\x00\x12\x0c\n\x08PALETTE8\x10\x01\x12\n\n\x06ITER16\x10\x02\x32\x8c\x04\n\x0e\x46ractalService\x12?\n\x0e\x43\x61lculateJulia\x12\x15.fractal.JuliaRequest\x1a\x16.fractal.JuliaResponse\x12P\n\x13\x43\x61lculateJuliaBatch\x12\x1a.fractal.JuliaBatchRequest\x1a\x1b.fractal.JuliaBatchResponse0\x01\x12\x44\n\x14\x43\x61lculateJuliaStream\x12\x15.fractal.JuliaRequest\x1a\x13.fractal.FrameChunk0\x01\x12J\n\x10RenderTrajectory\x12\x1a.fractal.TrajectoryRequest\x1a\x18.fractal.TrajectoryFrame0\x01\x12G\n\x12InteractiveSession\x12\x16.fractal.SessionUpdate\x1a\x15.fractal.SessionFrame(\x01\x30\x01\x12?\n\x08Shutdown\x12\x18.fractal.ShutdownRequest\x1a\x19.fractal.ShutdownResponse\x12K\n\x0eGetServerStats\x12\x1b.fractal.ServerStatsRequest\x1a\x1c.fractal.ServerStatsResponseb\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'fractal_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   DESCRIPTOR._loaded_options = None
+  _globals['_FRAMEENCODING']._serialized_start=1835
+  _globals['_FRAMEENCODING']._serialized_end=1891
+  _globals['_PIXELFORMAT']._serialized_start=1893
+  _globals['_PIXELFORMAT']._serialized_end=1943
   _globals['_JULIAREQUEST']._serialized_start=27
-  _globals['_JULIAREQUEST']._serialized_end=209
-  _globals['_JULIARESPONSE']._serialized_start=211
-  _globals['_JULIARESPONSE']._serialized_end=293
-  _globals['_SHUTDOWNREQUEST']._serialized_start=295
-  _globals['_SHUTDOWNREQUEST']._serialized_end=312
-  _globals['_SHUTDOWNRESPONSE']._serialized_start=314
-  _globals['_SHUTDOWNRESPONSE']._serialized_end=349
-  _globals['_FRACTALSERVICE']._serialized_start=352
-  _globals['_FRACTALSERVICE']._serialized_end=498
+  _globals['_JULIAREQUEST']._serialized_end=348
+  _globals['_SHAREDFRAME']._serialized_start=350
+  _globals['_SHAREDFRAME']._serialized_end=427
+  _globals['_JULIARESPONSE']._serialized_start=430
+  _globals['_JULIARESPONSE']._serialized_end=660
+  _globals['_JULIABATCHREQUEST']._serialized_start=662
+  _globals['_JULIABATCHREQUEST']._serialized_end=722
+  _globals['_JULIABATCHRESPONSE']._serialized_start=724
+  _globals['_JULIABATCHRESPONSE']._serialized_end=801
+  _globals['_FRAMECHUNK']._serialized_start=804
+  _globals['_FRAMECHUNK']._serialized_end=991
+  _globals['_TRAJECTORYREQUEST']._serialized_start=994
+  _globals['_TRAJECTORYREQUEST']._serialized_end=1177
+  _globals['_TRAJECTORYFRAME']._serialized_start=1179
+  _globals['_TRAJECTORYFRAME']._serialized_end=1291
+  _globals['_SESSIONUPDATE']._serialized_start=1293
+  _globals['_SESSIONUPDATE']._serialized_end=1364
+  _globals['_SESSIONFRAME']._serialized_start=1366
+  _globals['_SESSIONFRAME']._serialized_end=1465
+  _globals['_SERVERSTATSREQUEST']._serialized_start=1467
+  _globals['_SERVERSTATSREQUEST']._serialized_end=1487
+  _globals['_SERVERSTATSRESPONSE']._serialized_start=1490
+  _globals['_SERVERSTATSRESPONSE']._serialized_end=1777
+  _globals['_SHUTDOWNREQUEST']._serialized_start=1779
+  _globals['_SHUTDOWNREQUEST']._serialized_end=1796
+  _globals['_SHUTDOWNRESPONSE']._serialized_start=1798
+  _globals['_SHUTDOWNRESPONSE']._serialized_end=1833
+  _globals['_FRACTALSERVICE']._serialized_start=1946
+  _globals['_FRACTALSERVICE']._serialized_end=2470
 # @@protoc_insertion_point(module_scope)
@@ -39,11 +39,36 @@ class FractalServiceStub(object):
                 request_serializer=fractal__pb2.JuliaRequest.SerializeToString,
                 response_deserializer=fractal__pb2.JuliaResponse.FromString,
                 _registered_method=True)
+        self.CalculateJuliaBatch = channel.unary_stream(
+                '/fractal.FractalService/CalculateJuliaBatch',
+                request_serializer=fractal__pb2.JuliaBatchRequest.SerializeToString,
+                response_deserializer=fractal__pb2.JuliaBatchResponse.FromString,
+                _registered_method=True)
+        self.CalculateJuliaStream = channel.unary_stream(
+                '/fractal.FractalService/CalculateJuliaStream',
+                request_serializer=fractal__pb2.JuliaRequest.SerializeToString,
+                response_deserializer=fractal__pb2.FrameChunk.FromString,
+                _registered_method=True)
+        self.RenderTrajectory = channel.unary_stream(
+                '/fractal.FractalService/RenderTrajectory',
+                request_serializer=fractal__pb2.TrajectoryRequest.SerializeToString,
+                response_deserializer=fractal__pb2.TrajectoryFrame.FromString,
+                _registered_method=True)
+        self.InteractiveSession = channel.stream_stream(
+                '/fractal.FractalService/InteractiveSession',
+                request_serializer=fractal__pb2.SessionUpdate.SerializeToString,
+                response_deserializer=fractal__pb2.SessionFrame.FromString,
+                _registered_method=True)
         self.Shutdown = channel.unary_unary(
                 '/fractal.FractalService/Shutdown',
                 request_serializer=fractal__pb2.ShutdownRequest.SerializeToString,
                 response_deserializer=fractal__pb2.ShutdownResponse.FromString,
                 _registered_method=True)
+        self.GetServerStats = channel.unary_unary(
+                '/fractal.FractalService/GetServerStats',
+                request_serializer=fractal__pb2.ServerStatsRequest.SerializeToString,
+                response_deserializer=fractal__pb2.ServerStatsResponse.FromString,
+                _registered_method=True)
 
 
 class FractalServiceServicer(object):
@@ -55,12 +80,44 @@ class FractalServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def CalculateJuliaBatch(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def CalculateJuliaStream(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def RenderTrajectory(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def InteractiveSession(self, request_iterator, context):
+        """The client pushes updates as the view changes and gets frames back as they finish; the server only
+        ever renders the newest update, dropping older ones and cancelling a render they made stale.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def Shutdown(self, request, context):
         """Missing associated documentation comment in .proto file."""
         context.set_code(grpc.StatusCode.UNIMPLEMENTED)
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def GetServerStats(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
 
 def add_FractalServiceServicer_to_server(servicer, server):
     rpc_method_handlers = {
@@ -69,11 +126,36 @@ def add_FractalServiceServicer_to_server(servicer, server):
                     request_deserializer=fractal__pb2.JuliaRequest.FromString,
                     response_serializer=fractal__pb2.JuliaResponse.SerializeToString,
             ),
+            'CalculateJuliaBatch': grpc.unary_stream_rpc_method_handler(
+                    servicer.CalculateJuliaBatch,
+                    request_deserializer=fractal__pb2.JuliaBatchRequest.FromString,
+                    response_serializer=fractal__pb2.JuliaBatchResponse.SerializeToString,
+            ),
+            'CalculateJuliaStream': grpc.unary_stream_rpc_method_handler(
+                    servicer.CalculateJuliaStream,
+                    request_deserializer=fractal__pb2.JuliaRequest.FromString,
+                    response_serializer=fractal__pb2.FrameChunk.SerializeToString,
+            ),
+            'RenderTrajectory': grpc.unary_stream_rpc_method_handler(
+                    servicer.RenderTrajectory,
+                    request_deserializer=fractal__pb2.TrajectoryRequest.FromString,
+                    response_serializer=fractal__pb2.TrajectoryFrame.SerializeToString,
+            ),
+            'InteractiveSession': grpc.stream_stream_rpc_method_handler(
+                    servicer.InteractiveSession,
+                    request_deserializer=fractal__pb2.SessionUpdate.FromString,
+                    response_serializer=fractal__pb2.SessionFrame.SerializeToString,
+            ),
             'Shutdown': grpc.unary_unary_rpc_method_handler(
                     servicer.Shutdown,
                     request_deserializer=fractal__pb2.ShutdownRequest.FromString,
                     response_serializer=fractal__pb2.ShutdownResponse.SerializeToString,
             ),
+            'GetServerStats': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetServerStats,
+                    request_deserializer=fractal__pb2.ServerStatsRequest.FromString,
+                    response_serializer=fractal__pb2.ServerStatsResponse.SerializeToString,
+            ),
     }
     generic_handler = grpc.method_handlers_generic_handler(
             'fractal.FractalService', rpc_method_handlers)
@@ -112,6 +194,114 @@ class FractalService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def CalculateJuliaBatch(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(
+            request,
+            target,
+            '/fractal.FractalService/CalculateJuliaBatch',
+            fractal__pb2.JuliaBatchRequest.SerializeToString,
+            fractal__pb2.JuliaBatchResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def CalculateJuliaStream(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(
+            request,
+            target,
+            '/fractal.FractalService/CalculateJuliaStream',
+            fractal__pb2.JuliaRequest.SerializeToString,
+            fractal__pb2.FrameChunk.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def RenderTrajectory(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(
+            request,
+            target,
+            '/fractal.FractalService/RenderTrajectory',
+            fractal__pb2.TrajectoryRequest.SerializeToString,
+            fractal__pb2.TrajectoryFrame.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def InteractiveSession(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(
+            request_iterator,
+            target,
+            '/fractal.FractalService/InteractiveSession',
+            fractal__pb2.SessionUpdate.SerializeToString,
+            fractal__pb2.SessionFrame.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def Shutdown(request,
             target,
@@ -138,3 +328,30 @@ class FractalService(object):
             timeout,
             metadata,
             _registered_method=True)
+
+    @staticmethod
+    def GetServerStats(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/fractal.FractalService/GetServerStats',
+            fractal__pb2.ServerStatsRequest.SerializeToString,
+            fractal__pb2.ServerStatsResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
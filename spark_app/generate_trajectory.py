@@ -46,6 +46,112 @@ def generate_trajectory(total_requests: int, output_dir: str, clear_existing: bo
     if delay == 0:
         print(f"{total_requests} request files in '{output_dir}/'")
 
+def read_varint(data: bytes, pos: int):
+    value = shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+
+def xor_into(frame: bytearray, at: int, changes: bytes):
+    end = at + len(changes)
+    frame[at:end] = (int.from_bytes(frame[at:end], "little") ^ int.from_bytes(changes, "little")).to_bytes(
+        len(changes), "little")
+
+def apply_delta(frame: bytearray, data: bytes, encoding: int, width: int, height: int):
+    """Turns frame, the previous frame of the stream, into the one a delta response (XRLE or DEFLATE,
+    see FrameEncoding in fractal.proto) describes, in place."""
+    import struct
+    import zlib
+    from spark_app import fractal_pb2
+
+    row_bytes = len(frame) // height
+    band_count, band_rows = struct.unpack_from("<II", data)
+    sizes = struct.unpack_from(f"<{band_count}I", data, 8)
+    offset = 8 + 4 * band_count
+    for band, size in enumerate(sizes):
+        payload = data[offset:offset + size]
+        offset += size
+        at = band * band_rows * row_bytes
+        if encoding == fractal_pb2.DEFLATE:
+            xor_into(frame, at, zlib.decompress(payload))
+            continue
+        if encoding != fractal_pb2.XRLE:
+            raise ValueError(f"unsupported delta encoding {encoding}")
+        pos = 0
+        while pos < len(payload):
+            skip, pos = read_varint(payload, pos)
+            changed, pos = read_varint(payload, pos)
+            at += skip
+            xor_into(frame, at, payload[pos:pos + changed])
+            at += changed
+            pos += changed
+
+def stream_trajectory(total_requests: int, target: str, lookahead: int = 0, attempts: int = 3,
+                      keyframe_interval: int = 0):
+    """Has the server walk the same trajectory itself (RenderTrajectory) instead of one request per frame.
+    With keyframe_interval the frames in between come as deltas and are applied to the last one here."""
+    import sys
+    sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    from spark_app.grpc_client import get_stub
+    from spark_app.render_large import decode_band
+    from spark_app import fractal_pb2
+    
+    stub = get_stub(target)
+    request = fractal_pb2.TrajectoryRequest(
+        frame=fractal_pb2.JuliaRequest(
+            c_real=-0.8,
+            c_imag=0.156,
+            width=800,
+            height=600,
+            max_iterations=100,
+            poly_degree=2,
+            x_min=-2.0,
+            x_max=2.0,
+            y_min=-2.0,
+            y_max=2.0,
+            format=fractal_pb2.PALETTE8,
+            encoding=fractal_pb2.DEFLATE,
+        ),
+        step_real=0.0015,
+        step_imag=0.0008,
+        frame_count=total_requests,
+        lookahead=lookahead,
+        keyframe_interval=keyframe_interval,
+    )
+    
+    start = time.time()
+    received = 0
+    wire_bytes = 0
+    pixels = None
+    for attempt in range(attempts):
+        # a stream that broke off picks up at the first frame it did not deliver
+        request.first_frame = received
+        try:
+            for frame in stub.RenderTrajectory(request):
+                received = frame.frame_index + 1
+                response = frame.response
+                wire_bytes += len(response.rgba_data)
+                if response.delta:
+                    apply_delta(pixels, response.rgba_data, response.encoding,
+                                request.frame.width, request.frame.height)
+                elif keyframe_interval > 0:
+                    pixels = bytearray(decode_band(response.rgba_data, response.encoding))
+                print(f"Frame {frame.frame_index:4d} c=({frame.c_real:.6f}, {frame.c_imag:.6f}) -> "
+                      f"{response.server_id}: {(time.time() - start) * 1000:.1f}ms "
+                      f"(calc: {response.calculation_time_ms:.2f}ms, "
+                      f"{'delta' if response.delta else 'frame'} {len(response.rgba_data)} bytes)")
+            break
+        except Exception as e:
+            print(f"Stream broke off after {received} frames: {e}")
+    
+    elapsed = time.time() - start
+    print(f"{received}/{total_requests} frames in {elapsed:.2f}s ({received / max(elapsed, 1e-9):.1f} fps), "
+          f"{wire_bytes} bytes of pixels")
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(
         description="Generate Julia set parameter trajectory for Spark Streaming"
@@ -74,6 +180,23 @@ if __name__ == "__main__":
         default=0, 
         help="Manual delay in seconds between file generation"
     )
+    parser.add_argument(
+        "--stream",
+        action="store_true",
+        help="Render the trajectory on the server with RenderTrajectory instead of writing request files"
+    )
+    parser.add_argument(
+        "--target",
+        type=str,
+        default="127.0.0.1:50051,127.0.0.1:50052",
+        help="Server addresses for --stream"
+    )
+    parser.add_argument(
+        "--keyframes",
+        type=int,
+        default=0,
+        help="With --stream: send every N-th frame whole and the ones between as deltas"
+    )
     parser.add_argument(
         "--keep-existing",
         action="store_true",
@@ -86,4 +209,7 @@ if __name__ == "__main__":
     if args.duration > 0:
         final_delay = args.duration / args.total
         
-    generate_trajectory(args.total, args.output, clear_existing=not args.keep_existing, delay=final_delay)
+    if args.stream:
+        stream_trajectory(args.total, args.target, keyframe_interval=args.keyframes)
+    else:
+        generate_trajectory(args.total, args.output, clear_existing=not args.keep_existing, delay=final_delay)
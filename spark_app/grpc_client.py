@@ -1,7 +1,10 @@
 import grpc
+import mmap
+import struct
 
 _channel = None
 _stub = None
+_rings = {}
 
 def get_stub(target: str = "127.0.0.1:50051,127.0.0.1:50052"):
     global _channel, _stub
@@ -11,6 +14,7 @@ def get_stub(target: str = "127.0.0.1:50051,127.0.0.1:50052"):
             ('grpc.lb_policy_name', 'round_robin'),
             ('grpc.enable_retries', 1),
             ('grpc.service_config', '''{
+                "healthCheckConfig": {"serviceName": "fractal.FractalService"},
                 "methodConfig": [{
                     "name": [{}],
                     "retryPolicy": {
@@ -18,15 +22,40 @@ def get_stub(target: str = "127.0.0.1:50051,127.0.0.1:50052"):
                         "initialBackoff": "0.1s",
                         "maxBackoff": "1s",
                         "backoffMultiplier": 2,
-                        "retryableStatusCodes": ["UNAVAILABLE"]
+                        "retryableStatusCodes": ["UNAVAILABLE", "RESOURCE_EXHAUSTED"]
                     }
                 }]
             }''')
         ]
         
-        _channel = grpc.insecure_channel(f"ipv4:{target}", options=options)
+        # unix:PATH reaches a server on this host started with FRACTAL_UNIX_SOCKET
+        _channel = grpc.insecure_channel(target if target.startswith("unix:") else f"ipv4:{target}", options=options)
         
         from . import fractal_pb2_grpc
         _stub = fractal_pb2_grpc.FractalServiceStub(_channel)
     
     return _stub
+
+def frame_pixels(response) -> memoryview:
+    """The encoded pixels of a response: rgba_data, or, when the server left them in its shared frame ring
+    (JuliaResponse.shared), a view of them in place. Check frame_intact(response) once done with the view."""
+    if not response.HasField("shared"):
+        return memoryview(response.rgba_data)
+    shared = response.shared
+    ring = _rings.get(shared.name)
+    # a restarted server has a new object under the same name
+    if ring is None or struct.unpack_from("<Q", ring, 16)[0] != shared.instance:
+        with open("/dev/shm/" + shared.name.lstrip("/"), "rb") as f:
+            ring = mmap.mmap(f.fileno(), 0, prot=mmap.PROT_READ)
+        _rings[shared.name] = ring
+    capacity = struct.unpack_from("<Q", ring, 8)[0]
+    start = 64 + shared.position % capacity
+    return memoryview(ring)[start:start + shared.size]
+
+def frame_intact(response) -> bool:
+    """False if the server has lapped its ring over a shared frame since it was sent; ask for it again then."""
+    if not response.HasField("shared"):
+        return True
+    ring = _rings[response.shared.name]
+    capacity, _, reserved = struct.unpack_from("<QQQ", ring, 8)
+    return 0 <= reserved - response.shared.position <= capacity
@@ -0,0 +1,87 @@
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+def decode_band(data: bytes, encoding: int) -> bytes:
+    """Unpacks one FrameChunk payload (RAW or DEFLATE, see FrameEncoding in fractal.proto)."""
+    from spark_app import fractal_pb2
+
+    if encoding == fractal_pb2.RAW:
+        return data
+    if encoding != fractal_pb2.DEFLATE:
+        raise ValueError(f"unsupported encoding {encoding}")
+    band_count, _ = struct.unpack_from("<II", data)
+    sizes = struct.unpack_from(f"<{band_count}I", data, 8)
+    offset = 8 + 4 * band_count
+    parts = []
+    for size in sizes:
+        parts.append(zlib.decompress(data[offset:offset + size]))
+        offset += size
+    return b"".join(parts)
+
+def render_large(width: int, height: int, output: str, target: str, max_iterations: int = 100,
+                 c_real: float = -0.8, c_imag: float = 0.156):
+    """Streams a frame of any size with CalculateJuliaStream and writes each band of rows into a PPM as it
+    arrives, so neither side ever holds the whole frame."""
+    sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    from spark_app.grpc_client import get_stub
+    from spark_app import fractal_pb2
+
+    stub = get_stub(target)
+    request = fractal_pb2.JuliaRequest(
+        c_real=c_real,
+        c_imag=c_imag,
+        width=width,
+        height=height,
+        max_iterations=max_iterations,
+        poly_degree=2,
+        x_min=-2.0,
+        x_max=2.0,
+        y_min=-2.0,
+        y_max=2.0,
+        format=fractal_pb2.RGBA8,
+        encoding=fractal_pb2.DEFLATE,
+    )
+
+    header = f"P6\n{width} {height}\n255\n".encode()
+    start = time.time()
+    first_band = None
+    rows_done = 0
+    with open(output, "wb") as f:
+        f.write(header)
+        f.truncate(len(header) + width * height * 3)
+        for chunk in stub.CalculateJuliaStream(request):
+            if first_band is None:
+                first_band = time.time() - start
+            rgba = decode_band(chunk.data, chunk.encoding)
+            rgb = bytearray(len(rgba) // 4 * 3)
+            for channel in range(3):
+                rgb[channel::3] = rgba[channel::4]
+            f.seek(len(header) + chunk.first_row * width * 3)
+            f.write(rgb)
+            rows_done += chunk.rows
+
+    elapsed = time.time() - start
+    print(f"{width}x{height} -> {output}: {rows_done} rows in {elapsed:.2f}s "
+          f"(first band after {(first_band or 0) * 1000:.1f}ms)")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Render one Julia set frame of any size on a server and save it as PPM"
+    )
+    parser.add_argument("--width", type=int, default=7680, help="Frame width in pixels")
+    parser.add_argument("--height", type=int, default=4320, help="Frame height in pixels")
+    parser.add_argument("--iterations", type=int, default=100, help="Maximum iterations")
+    parser.add_argument("--out", type=str, default="julia.ppm", help="Output PPM file")
+    parser.add_argument(
+        "--target",
+        type=str,
+        default="127.0.0.1:50051,127.0.0.1:50052",
+        help="Server addresses"
+    )
+
+    args = parser.parse_args()
+    render_large(args.width, args.height, args.out, args.target, args.iterations)
@@ -20,7 +20,10 @@ def init_metrics_file():
     os.makedirs(os.path.dirname(METRICS_FILE), exist_ok=True)
     with open(METRICS_FILE, "w", newline="") as f:
         writer = csv.writer(f)
-        writer.writerow(["sent_time", "end_time", "frame_id", "worker", "latency_ms", "calc_time_ms", "success"])
+        # latency_ms is the round trip of a frame's own call; frames that came back in a partition's batch
+        # call have none and record batch_elapsed_ms, the time from the start of that call, instead
+        writer.writerow(["sent_time", "end_time", "frame_id", "worker", "latency_ms", "calc_time_ms", "success",
+                         "batch_elapsed_ms"])
 
 def process_micro_batch(batch_df, batch_id: int):
     def render_partition(partition_iterator):
@@ -29,38 +32,67 @@ def process_micro_batch(batch_df, batch_id: int):
         import grpc
         
         stub = get_stub()
+        rows = list(partition_iterator)
+        if not rows:
+            return
         
-        for row in partition_iterator:
-            start_time = time.time()
+        requests = [
+            fractal_pb2.JuliaRequest(
+                c_real=row.c_real,
+                c_imag=row.c_imag,
+                width=row.width or 800,
+                height=row.height or 600,
+                max_iterations=row.max_iterations or 100,
+                poly_degree=row.poly_degree or 2,
+                x_min=-2.0,
+                x_max=2.0,
+                y_min=-2.0,
+                y_max=2.0,
+                format=fractal_pb2.PALETTE8,
+                encoding=fractal_pb2.DEFLATE,
+                # FRACTAL_SHM=1 when the workers share this host: frames stay in their shared frame rings
+                shared_memory=os.environ.get("FRACTAL_SHM") == "1",
+            )
+            for row in rows
+        ]
+        
+        # the whole partition goes out as one call; frames stream back as the server finishes them
+        start_time = time.time()
+        delivered = {}
+        try:
+            for item in stub.CalculateJuliaBatch(fractal_pb2.JuliaBatchRequest(requests=requests)):
+                delivered[item.index] = (time.time(), item.response)
+        except Exception as e:
+            print(f"Batch of {len(rows)} frames: {e}")
+        
+        for index, row in enumerate(rows):
             worker_addr = "unknown"
             calc_time_ms = 0.0
+            success = 0
+            sent_time = start_time
+            latency_ms = None
+            batch_elapsed_ms = None
             
             try:
-                request = fractal_pb2.JuliaRequest(
-                    c_real=row.c_real,
-                    c_imag=row.c_imag,
-                    width=row.width or 800,
-                    height=row.height or 600,
-                    max_iterations=row.max_iterations or 100,
-                    poly_degree=row.poly_degree or 2,
-                    x_min=-2.0,
-                    x_max=2.0,
-                    y_min=-2.0,
-                    y_max=2.0,
-                )
-                
-                response = stub.CalculateJulia(request)
+                if index in delivered:
+                    end_time, response = delivered[index]
+                    batch_elapsed_ms = (end_time - start_time) * 1000
+                else:
+                    # a stream that broke off is not retried by the channel, so the missing frames go one by one
+                    sent_time = time.time()
+                    response = stub.CalculateJulia(requests[index])
+                    end_time = time.time()
+                    latency_ms = (end_time - sent_time) * 1000
                 calc_time_ms = response.calculation_time_ms
                 worker_addr = response.server_id or "unknown"
                 success = 1
                 
             except Exception as e:
                 print(f"Frame {row.frame_id}: {e}")
-                success = 0
+                end_time = time.time()
+                latency_ms = (end_time - sent_time) * 1000
             
-            latency_ms = (time.time() - start_time) * 1000
-            end_time = time.time()
-            yield (start_time, end_time, row.frame_id, worker_addr, latency_ms, calc_time_ms, success)
+            yield (sent_time, end_time, row.frame_id, worker_addr, latency_ms, calc_time_ms, success, batch_elapsed_ms)
     
     results = batch_df.rdd.mapPartitions(render_partition).collect()
     
@@ -69,7 +101,8 @@ def process_micro_batch(batch_df, batch_id: int):
         for r in results:
             writer.writerow(r)
             status = "OK" if r[6] else "FAIL"
-            print(f"{batch_id} Frame {r[2]:3d} -> {r[3]}: {r[4]:.1f}ms (calc: {r[5]:.2f}ms) {status}")
+            timing = f"{r[4]:.1f}ms" if r[4] is not None else f"{r[7]:.1f}ms into batch"
+            print(f"{batch_id} Frame {r[2]:3d} -> {r[3]}: {timing} (calc: {r[5]:.2f}ms) {status}")
 
 def main(total_requests: int, duration: int):
     trigger_seconds = duration / total_requests
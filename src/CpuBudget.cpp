@@ -0,0 +1,134 @@
+#include "../headers/CpuBudget.hpp"
+#include <sched.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// the cgroup v2 path of this process ("0::/path" in /proc/self/cgroup), "/" if there is none
+std::string unified_cgroup_path() {
+    std::ifstream in("/proc/self/cgroup");
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.compare(0, 3, "0::") == 0) {
+            return line.size() > 3 ? line.substr(3) : "/";
+        }
+    }
+    return "/";
+}
+
+// CPUs allowed by one cgroup directory, 0 if it sets no limit or has no quota file
+double quota_in(const std::string& dir) {
+    std::ifstream v2(dir + "/cpu.max");
+    if (v2) {
+        std::string quota;
+        double period = 0;
+        if (v2 >> quota >> period && quota != "max" && period > 0) {
+            return std::stod(quota) / period;
+        }
+        return 0;
+    }
+    std::ifstream quota_file(dir + "/cpu.cfs_quota_us");
+    std::ifstream period_file(dir + "/cpu.cfs_period_us");
+    double quota = -1, period = 0;
+    if (quota_file >> quota && period_file >> period && quota > 0 && period > 0) {
+        return quota / period;
+    }
+    return 0;
+}
+
+}
+
+int CpuBudget::affinityCpus() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        return CPU_COUNT(&set);
+    }
+    int hw = static_cast<int>(std::thread::hardware_concurrency());
+    return hw > 0 ? hw : 1;
+}
+
+int CpuBudget::quotaCpus() {
+    // the tightest quota on the way from this process's cgroup up to the root (v2), or the v1 cpu controller
+    double best = 0;
+    std::string path = unified_cgroup_path();
+    for (;;) {
+        double q = quota_in("/sys/fs/cgroup" + (path == "/" ? std::string() : path));
+        if (q > 0 && (best == 0 || q < best)) {
+            best = q;
+        }
+        if (path == "/" || path.empty()) {
+            break;
+        }
+        size_t slash = path.find_last_of('/');
+        path = (slash == 0 || slash == std::string::npos) ? "/" : path.substr(0, slash);
+    }
+    if (best == 0) {
+        best = quota_in("/sys/fs/cgroup/cpu");
+    }
+    return best > 0 ? static_cast<int>(std::ceil(best)) : 0;
+}
+
+int CpuBudget::threads() {
+    static const int budget = [] {
+        int cpus = affinityCpus();
+        int quota = quotaCpus();
+        if (quota > 0 && quota < cpus) {
+            cpus = quota;
+        }
+        return cpus > 0 ? cpus : 1;
+    }();
+    return budget;
+}
+
+bool CpuBudget::applyPartition(int index, int count) {
+    cpu_set_t current;
+    CPU_ZERO(&current);
+    if (count < 1 || index < 0 || index >= count || sched_getaffinity(0, sizeof(current), &current) != 0) {
+        std::cerr << "Warning: invalid CPU partition " << index << "/" << count << ", keeping all CPUs." << std::endl;
+        return false;
+    }
+
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &current)) {
+            cpus.push_back(cpu);
+        }
+    }
+    int n = static_cast<int>(cpus.size());
+    if (n < count) {
+        std::cerr << "Warning: only " << n << " CPUs for " << count << " partitions, keeping all CPUs." << std::endl;
+        return false;
+    }
+
+    // contiguous slices, the first n % count slices one CPU larger
+    int begin = index * (n / count) + std::min(index, n % count);
+    int size = n / count + (index < n % count ? 1 : 0);
+    cpu_set_t slice;
+    CPU_ZERO(&slice);
+    for (int i = begin; i < begin + size; ++i) {
+        CPU_SET(cpus[i], &slice);
+    }
+    if (sched_setaffinity(0, sizeof(slice), &slice) != 0) {
+        std::cerr << "Warning: sched_setaffinity failed, keeping all CPUs." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool CpuBudget::applyPartition(const std::string& spec) {
+    std::istringstream in(spec);
+    int index = -1, count = 0;
+    char slash = 0;
+    if (!(in >> index >> slash >> count) || slash != '/') {
+        std::cerr << "Warning: CPU partition '" << spec << "' is not index/count, keeping all CPUs." << std::endl;
+        return false;
+    }
+    return applyPartition(index, count);
+}
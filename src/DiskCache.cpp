@@ -0,0 +1,172 @@
+#include "../headers/DiskCache.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <mutex>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace {
+const char FILE_MAGIC[8] = {'J', 'U', 'L', 'I', 'A', 'F', 'C', '1'};
+const uint32_t RECORD_MAGIC = 0x4a464352; // "RCFJ"
+
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t key_size;
+    uint32_t pixels_size;
+    int32_t encoding;
+    int32_t format;
+    uint32_t crc;
+};
+
+uint32_t record_crc(const char* key, size_t key_size, const char* pixels, size_t pixels_size) {
+    uLong crc = crc32(0L, reinterpret_cast<const Bytef*>(key), static_cast<uInt>(key_size));
+    return static_cast<uint32_t>(crc32(crc, reinterpret_cast<const Bytef*>(pixels), static_cast<uInt>(pixels_size)));
+}
+}
+
+DiskCache::DiskCache(const std::string& path, size_t capacity_bytes)
+    : fd(-1), map(nullptr), capacity(capacity_bytes), end(sizeof(FILE_MAGIC)), hits(0) {
+    if (capacity <= sizeof(FILE_MAGIC) + sizeof(RecordHeader)) {
+        std::cerr << "Warning: disk cache capacity too small, disk cache disabled." << std::endl;
+        return;
+    }
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "Warning: cannot open disk cache " << path << ": " << std::strerror(errno) << std::endl;
+        return;
+    }
+    // two servers appending to one file would corrupt each other's records
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        std::cerr << "Warning: disk cache " << path << " is in use by another process, disk cache disabled." << std::endl;
+        close(fd);
+        fd = -1;
+        return;
+    }
+    // reserve the whole capacity up front: appends grow the file under the mapping, never move it
+    void* mapped = mmap(nullptr, capacity, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Warning: cannot map disk cache " << path << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        fd = -1;
+        return;
+    }
+    map = static_cast<const char*>(mapped);
+
+    struct stat st;
+    uint64_t file_size = fstat(fd, &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+    if (file_size < sizeof(FILE_MAGIC) || file_size > capacity || std::memcmp(map, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+        if (file_size > 0) {
+            std::cerr << "Warning: disk cache " << path << " is not a cache file of this size, starting it over." << std::endl;
+        }
+        reset();
+        return;
+    }
+    scan(file_size);
+}
+
+DiskCache::~DiskCache() {
+    if (map) {
+        munmap(const_cast<char*>(map), capacity);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+void DiskCache::scan(uint64_t file_size) {
+    uint64_t offset = sizeof(FILE_MAGIC);
+    while (offset + sizeof(RecordHeader) <= file_size) {
+        RecordHeader header;
+        std::memcpy(&header, map + offset, sizeof(header));
+        uint64_t body = offset + sizeof(header);
+        if (header.magic != RECORD_MAGIC || body + header.key_size + header.pixels_size > file_size) {
+            break;
+        }
+        const char* key = map + body;
+        const char* pixels = key + header.key_size;
+        if (record_crc(key, header.key_size, pixels, header.pixels_size) != header.crc) {
+            break;
+        }
+        // a key written twice keeps its latest frame
+        index[std::string(key, header.key_size)] = {body + header.key_size, header.pixels_size,
+                                                     header.encoding, header.format};
+        offset = body + header.key_size + header.pixels_size;
+    }
+    end = offset;
+    if (end < file_size) {
+        std::cerr << "Warning: dropping " << (file_size - end) << " torn bytes at the end of the disk cache." << std::endl;
+        if (ftruncate(fd, static_cast<off_t>(end)) != 0) {
+            std::cerr << "Warning: cannot truncate disk cache: " << std::strerror(errno) << std::endl;
+        }
+    }
+}
+
+void DiskCache::reset() {
+    index.clear();
+    end = sizeof(FILE_MAGIC);
+    if (ftruncate(fd, 0) != 0 || pwrite(fd, FILE_MAGIC, sizeof(FILE_MAGIC), 0) != static_cast<ssize_t>(sizeof(FILE_MAGIC))) {
+        std::cerr << "Warning: cannot initialise disk cache: " << std::strerror(errno) << ", disk cache disabled." << std::endl;
+        munmap(const_cast<char*>(map), capacity);
+        map = nullptr;
+    }
+}
+
+std::shared_ptr<const ResultCache::Frame> DiskCache::get(const std::string& key) {
+    // under the lock: a put() that runs out of disk may unmap the file through reset()
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (!map) {
+        return nullptr;
+    }
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return nullptr;
+    }
+    ++hits;
+    const Entry& entry = it->second;
+    return std::make_shared<const ResultCache::Frame>(
+        ResultCache::Frame{std::string(map + entry.offset, entry.size), entry.encoding, entry.format});
+}
+
+void DiskCache::put(const std::string& key, const ResultCache::Frame& frame) {
+    uint64_t record = sizeof(RecordHeader) + key.size() + frame.pixels.size();
+    if (sizeof(FILE_MAGIC) + record > capacity) {
+        return;
+    }
+    RecordHeader header{RECORD_MAGIC, static_cast<uint32_t>(key.size()), static_cast<uint32_t>(frame.pixels.size()),
+                        frame.encoding, frame.format,
+                        record_crc(key.data(), key.size(), frame.pixels.data(), frame.pixels.size())};
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (!map || index.count(key)) {
+        return;
+    }
+    if (end + record > capacity) {
+        reset();
+        if (!map) {
+            return;
+        }
+    }
+    iovec parts[3] = {{&header, sizeof(header)},
+                      {const_cast<char*>(key.data()), key.size()},
+                      {const_cast<char*>(frame.pixels.data()), frame.pixels.size()}};
+    if (pwritev(fd, parts, 3, static_cast<off_t>(end)) != static_cast<ssize_t>(record)) {
+        std::cerr << "Warning: disk cache write failed: " << std::strerror(errno) << std::endl;
+        if (ftruncate(fd, static_cast<off_t>(end)) != 0) {
+            reset();
+        }
+        return;
+    }
+    index[key] = {end + sizeof(header) + key.size(), header.pixels_size, header.encoding, header.format};
+    end += record;
+}
+
+DiskCache::Stats DiskCache::stats() {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return {hits.load(), index.size(), map ? end : 0, map ? capacity : 0};
+}
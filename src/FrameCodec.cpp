@@ -0,0 +1,376 @@
+#include "../headers/FrameCodec.hpp"
+#include "../headers/TileScheduler.hpp"
+#include <zlib.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace {
+
+// rows per independently coded band: enough for QOI runs and zlib windows to pay off, small enough
+// that an 800x600 frame still gives every core a band
+const unsigned int CODEC_BAND_ROWS = 32;
+
+struct Pixel {
+    sf::Uint8 r, g, b, a;
+    bool operator==(const Pixel& o) const { return r == o.r && g == o.g && b == o.b && a == o.a; }
+};
+
+inline int qoi_hash(const Pixel& p) {
+    return (p.r * 3 + p.g * 5 + p.b * 7 + p.a * 11) % 64;
+}
+
+void put_u32(std::string& out, size_t pos, sf::Uint32 v) {
+    out[pos] = static_cast<char>(v & 0xff);
+    out[pos + 1] = static_cast<char>((v >> 8) & 0xff);
+    out[pos + 2] = static_cast<char>((v >> 16) & 0xff);
+    out[pos + 3] = static_cast<char>((v >> 24) & 0xff);
+}
+
+sf::Uint32 get_u32(const char* p) {
+    const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+    return u[0] | (u[1] << 8) | (u[2] << 16) | (static_cast<sf::Uint32>(u[3]) << 24);
+}
+
+void qoi_encode(const sf::Uint8* rgba, size_t n_pixels, std::string& out) {
+    out.resize(n_pixels * 5);
+    unsigned char* o = reinterpret_cast<unsigned char*>(&out[0]);
+    size_t pos = 0;
+    Pixel index[64] = {};
+    Pixel prev = {0, 0, 0, 255};
+    int run = 0;
+
+    for (size_t i = 0; i < n_pixels; ++i) {
+        Pixel px;
+        std::memcpy(&px, rgba + i * 4, 4);
+        if (px == prev) {
+            if (++run == 62 || i + 1 == n_pixels) {
+                o[pos++] = 0xc0 | (run - 1);
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0) {
+            o[pos++] = 0xc0 | (run - 1);
+            run = 0;
+        }
+
+        int h = qoi_hash(px);
+        if (index[h] == px) {
+            o[pos++] = h;
+        } else {
+            index[h] = px;
+            if (px.a == prev.a) {
+                signed char vr = px.r - prev.r;
+                signed char vg = px.g - prev.g;
+                signed char vb = px.b - prev.b;
+                signed char vg_r = vr - vg;
+                signed char vg_b = vb - vg;
+                if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+                    o[pos++] = 0x40 | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+                } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+                    o[pos++] = 0x80 | (vg + 32);
+                    o[pos++] = (vg_r + 8) << 4 | (vg_b + 8);
+                } else {
+                    o[pos++] = 0xfe;
+                    o[pos++] = px.r;
+                    o[pos++] = px.g;
+                    o[pos++] = px.b;
+                }
+            } else {
+                o[pos++] = 0xff;
+                o[pos++] = px.r;
+                o[pos++] = px.g;
+                o[pos++] = px.b;
+                o[pos++] = px.a;
+            }
+        }
+        prev = px;
+    }
+    out.resize(pos);
+}
+
+bool qoi_decode(const unsigned char* in, size_t size, size_t n_pixels, sf::Uint8* rgba) {
+    Pixel index[64] = {};
+    Pixel px = {0, 0, 0, 255};
+    size_t pos = 0;
+    int run = 0;
+
+    for (size_t i = 0; i < n_pixels; ++i) {
+        if (run > 0) {
+            --run;
+        } else {
+            if (pos >= size) return false;
+            unsigned char b1 = in[pos++];
+            if (b1 == 0xfe) {
+                if (pos + 3 > size) return false;
+                px.r = in[pos]; px.g = in[pos + 1]; px.b = in[pos + 2];
+                pos += 3;
+            } else if (b1 == 0xff) {
+                if (pos + 4 > size) return false;
+                px.r = in[pos]; px.g = in[pos + 1]; px.b = in[pos + 2]; px.a = in[pos + 3];
+                pos += 4;
+            } else if ((b1 & 0xc0) == 0x00) {
+                px = index[b1];
+            } else if ((b1 & 0xc0) == 0x40) {
+                px.r += ((b1 >> 4) & 0x03) - 2;
+                px.g += ((b1 >> 2) & 0x03) - 2;
+                px.b += (b1 & 0x03) - 2;
+            } else if ((b1 & 0xc0) == 0x80) {
+                if (pos >= size) return false;
+                unsigned char b2 = in[pos++];
+                int vg = (b1 & 0x3f) - 32;
+                px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+                px.g += vg;
+                px.b += vg - 8 + (b2 & 0x0f);
+            } else {
+                run = b1 & 0x3f;
+            }
+            index[qoi_hash(px)] = px;
+        }
+        std::memcpy(rgba + i * 4, &px, 4);
+    }
+    return true;
+}
+
+void deflate_encode(const sf::Uint8* bytes, size_t n_bytes, std::string& out) {
+    uLongf len = compressBound(n_bytes);
+    out.resize(len);
+    compress2(reinterpret_cast<Bytef*>(&out[0]), &len, bytes, n_bytes, Z_BEST_SPEED);
+    out.resize(len);
+}
+
+bool deflate_decode(const unsigned char* in, size_t size, size_t n_bytes, sf::Uint8* bytes) {
+    uLongf len = n_bytes;
+    return uncompress(bytes, &len, in, size) == Z_OK && len == n_bytes;
+}
+
+// Xrle: pairs of varint lengths, unchanged bytes to skip and changed bytes to follow, then the changed
+// bytes XORed with the previous frame. Gaps shorter than this stay inside the changed run, as two more
+// length bytes would cost as much.
+const size_t XRLE_MIN_GAP = 3;
+
+void put_varint(std::string& out, size_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<char>((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<char>(v));
+}
+
+bool get_varint(const unsigned char* in, size_t size, size_t& pos, size_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64 && pos < size; shift += 7) {
+        unsigned char b = in[pos++];
+        v |= static_cast<size_t>(b & 0x7f) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+void xrle_encode(const sf::Uint8* bytes, const sf::Uint8* previous, size_t n_bytes, std::string& out) {
+    out.clear();
+    size_t i = 0;
+    while (i < n_bytes) {
+        size_t skip_begin = i;
+        while (i < n_bytes && bytes[i] == previous[i]) ++i;
+        size_t changed_begin = i;
+        while (i < n_bytes) {
+            if (bytes[i] != previous[i]) {
+                ++i;
+                continue;
+            }
+            size_t j = i;
+            while (j < n_bytes && bytes[j] == previous[j] && j - i < XRLE_MIN_GAP) ++j;
+            if (j == n_bytes || j - i >= XRLE_MIN_GAP) break;
+            i = j;
+        }
+        if (i == changed_begin && i == n_bytes) break; // nothing but unchanged bytes left
+        put_varint(out, changed_begin - skip_begin);
+        put_varint(out, i - changed_begin);
+        for (size_t k = changed_begin; k < i; ++k) {
+            out.push_back(static_cast<char>(bytes[k] ^ previous[k]));
+        }
+    }
+}
+
+bool xrle_apply(const unsigned char* in, size_t size, size_t n_bytes, sf::Uint8* bytes) {
+    size_t pos = 0, at = 0;
+    while (pos < size) {
+        size_t skip, changed;
+        if (!get_varint(in, size, pos, skip) || !get_varint(in, size, pos, changed)) return false;
+        if (skip > n_bytes - at || changed > n_bytes - at - skip || changed > size - pos) return false;
+        at += skip;
+        for (size_t k = 0; k < changed; ++k) {
+            bytes[at + k] ^= in[pos + k];
+        }
+        at += changed;
+        pos += changed;
+    }
+    return true;
+}
+
+void for_each_band(int n_bands, TileScheduler* pool, const std::function<void(int)>& band) {
+    if (pool) {
+        pool->run(n_bands, band);
+        return;
+    }
+    #pragma omp parallel for schedule(dynamic)
+    for (int b = 0; b < n_bands; ++b) {
+        band(b);
+    }
+}
+
+}
+
+FrameCodec::Encoding FrameCodec::encode(const sf::Uint8* pixels, unsigned int width, unsigned int height,
+    unsigned int bytes_per_pixel, Encoding encoding, std::string& out, TileScheduler* pool) {
+    const size_t row_bytes = static_cast<size_t>(width) * bytes_per_pixel;
+    if (encoding != Qoi && encoding != Deflate) {
+        out.assign(reinterpret_cast<const char*>(pixels), row_bytes * height);
+        return Raw;
+    }
+    if (encoding == Qoi && bytes_per_pixel != 4) {
+        encoding = Deflate;
+    }
+
+    const int n_bands = (height + CODEC_BAND_ROWS - 1) / CODEC_BAND_ROWS;
+    std::vector<std::string> bands(n_bands);
+    for_each_band(n_bands, pool, [&](int b) {
+        unsigned int y_begin = b * CODEC_BAND_ROWS;
+        unsigned int rows = std::min(CODEC_BAND_ROWS, height - y_begin);
+        const sf::Uint8* src = pixels + y_begin * row_bytes;
+        if (encoding == Qoi) {
+            qoi_encode(src, static_cast<size_t>(width) * rows, bands[b]);
+        } else {
+            deflate_encode(src, row_bytes * rows, bands[b]);
+        }
+    });
+    join_bands(bands, out);
+    return encoding;
+}
+
+FrameCodec::Encoding FrameCodec::encodeDelta(const sf::Uint8* pixels, const sf::Uint8* previous, unsigned int width,
+    unsigned int height, unsigned int bytes_per_pixel, Encoding encoding, std::string& out, TileScheduler* pool) {
+    const size_t row_bytes = static_cast<size_t>(width) * bytes_per_pixel;
+    if (encoding != Deflate) {
+        encoding = Xrle;
+    }
+
+    const int n_bands = (height + CODEC_BAND_ROWS - 1) / CODEC_BAND_ROWS;
+    std::vector<std::string> bands(n_bands);
+    for_each_band(n_bands, pool, [&](int b) {
+        unsigned int y_begin = b * CODEC_BAND_ROWS;
+        size_t n_bytes = row_bytes * std::min(CODEC_BAND_ROWS, height - y_begin);
+        const sf::Uint8* src = pixels + y_begin * row_bytes;
+        const sf::Uint8* prev = previous + y_begin * row_bytes;
+        if (encoding == Xrle) {
+            xrle_encode(src, prev, n_bytes, bands[b]);
+            return;
+        }
+        std::vector<sf::Uint8> diff(n_bytes);
+        for (size_t i = 0; i < n_bytes; ++i) {
+            diff[i] = src[i] ^ prev[i];
+        }
+        deflate_encode(diff.data(), n_bytes, bands[b]);
+    });
+    join_bands(bands, out);
+    return encoding;
+}
+
+void FrameCodec::join_bands(const std::vector<std::string>& bands, std::string& out) {
+    size_t header = 8 + 4 * bands.size();
+    size_t total = header;
+    for (const std::string& b : bands) total += b.size();
+    out.assign(total, '\0');
+    put_u32(out, 0, static_cast<sf::Uint32>(bands.size()));
+    put_u32(out, 4, CODEC_BAND_ROWS);
+    size_t pos = header;
+    for (size_t b = 0; b < bands.size(); ++b) {
+        put_u32(out, 8 + 4 * b, static_cast<sf::Uint32>(bands[b].size()));
+        std::memcpy(&out[pos], bands[b].data(), bands[b].size());
+        pos += bands[b].size();
+    }
+}
+
+bool FrameCodec::split_bands(const char* data, size_t size, unsigned int height, sf::Uint32& band_rows,
+    std::vector<size_t>& offsets) {
+    if (size < 8) return false;
+    sf::Uint32 n_bands = get_u32(data);
+    band_rows = get_u32(data + 4);
+    offsets.clear();
+    if (n_bands == 0) return height == 0;
+    // the bands must cover the frame exactly, with the last one possibly short
+    if (band_rows == 0 || static_cast<size_t>(n_bands) * band_rows < height ||
+        static_cast<size_t>(n_bands - 1) * band_rows >= height ||
+        size < 8 + 4 * static_cast<size_t>(n_bands)) {
+        return false;
+    }
+
+    offsets.assign(n_bands + 1, 8 + 4 * static_cast<size_t>(n_bands));
+    for (sf::Uint32 b = 0; b < n_bands; ++b) {
+        offsets[b + 1] = offsets[b] + get_u32(data + 8 + 4 * b);
+    }
+    return offsets[n_bands] <= size;
+}
+
+bool FrameCodec::decode(const char* data, size_t size, unsigned int width, unsigned int height,
+    unsigned int bytes_per_pixel, Encoding encoding, sf::Uint8* pixels) {
+    const size_t row_bytes = static_cast<size_t>(width) * bytes_per_pixel;
+    if (encoding == Raw) {
+        if (size != row_bytes * height) return false;
+        std::memcpy(pixels, data, size);
+        return true;
+    }
+    if ((encoding != Qoi && encoding != Deflate) || (encoding == Qoi && bytes_per_pixel != 4)) return false;
+
+    sf::Uint32 band_rows;
+    std::vector<size_t> offsets;
+    if (!split_bands(data, size, height, band_rows, offsets)) return false;
+    if (offsets.empty()) return true;
+    sf::Uint32 n_bands = static_cast<sf::Uint32>(offsets.size() - 1);
+
+    std::vector<char> ok(n_bands, 0);
+    for_each_band(static_cast<int>(n_bands), nullptr, [&](int b) {
+        unsigned int y_begin = b * band_rows;
+        unsigned int rows = std::min(band_rows, height - y_begin);
+        const unsigned char* in = reinterpret_cast<const unsigned char*>(data) + offsets[b];
+        size_t in_size = offsets[b + 1] - offsets[b];
+        sf::Uint8* dst = pixels + y_begin * row_bytes;
+        ok[b] = (encoding == Qoi) ? qoi_decode(in, in_size, static_cast<size_t>(width) * rows, dst)
+                                  : deflate_decode(in, in_size, row_bytes * rows, dst);
+    });
+    return std::all_of(ok.begin(), ok.end(), [](char v) { return v != 0; });
+}
+
+bool FrameCodec::applyDelta(const char* data, size_t size, unsigned int width, unsigned int height,
+    unsigned int bytes_per_pixel, Encoding encoding, sf::Uint8* pixels) {
+    const size_t row_bytes = static_cast<size_t>(width) * bytes_per_pixel;
+    if (encoding != Xrle && encoding != Deflate) return false;
+
+    sf::Uint32 band_rows;
+    std::vector<size_t> offsets;
+    if (!split_bands(data, size, height, band_rows, offsets)) return false;
+    if (offsets.empty()) return true;
+    sf::Uint32 n_bands = static_cast<sf::Uint32>(offsets.size() - 1);
+
+    std::vector<char> ok(n_bands, 0);
+    for_each_band(static_cast<int>(n_bands), nullptr, [&](int b) {
+        unsigned int y_begin = b * band_rows;
+        size_t n_bytes = row_bytes * std::min(band_rows, height - y_begin);
+        const unsigned char* in = reinterpret_cast<const unsigned char*>(data) + offsets[b];
+        size_t in_size = offsets[b + 1] - offsets[b];
+        sf::Uint8* dst = pixels + y_begin * row_bytes;
+        if (encoding == Xrle) {
+            ok[b] = xrle_apply(in, in_size, n_bytes, dst);
+            return;
+        }
+        std::vector<sf::Uint8> diff(n_bytes);
+        ok[b] = deflate_decode(in, in_size, n_bytes, diff.data());
+        for (size_t i = 0; ok[b] && i < n_bytes; ++i) {
+            dst[i] ^= diff[i];
+        }
+    });
+    return std::all_of(ok.begin(), ok.end(), [](char v) { return v != 0; });
+}
@@ -2,8 +2,84 @@
 #include <cmath>
 #include <stdlib.h>
 #include <omp.h>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <climits>
 #include<iostream>
 
+namespace {
+
+// How many rows one thread colours and blurs in a go. Its three rolling rows stay in cache even for
+// 8K-wide frames, and each output row is written exactly once.
+const int POST_BAND_ROWS = 16;
+
+typedef void (*BlurRowFn)(const sf::Uint8*, const sf::Uint8*, const sf::Uint8*, sf::Uint8*, int, int);
+
+// colours and (optionally) blurs the rows of one band that fall in [first_row, last_row); ring holds
+// three rows and is reused between bands. iterations starts at frame row counts_row, rgba at first_row
+template <typename Count>
+void process_band(const Count* iterations, unsigned int width, unsigned int height,
+    const std::vector<sf::Uint32>& palette, bool blur, sf::Uint8* rgba, int band,
+    sf::Uint8* ring, BlurRowFn blur_row,
+    unsigned int counts_row = 0, unsigned int first_row = 0, unsigned int last_row = UINT_MAX) {
+
+    const size_t row_bytes = static_cast<size_t>(width) * 4;
+    auto colorize_row = [&](unsigned int y, sf::Uint8* out) {
+        const Count* counts = iterations + static_cast<size_t>(y - counts_row) * width;
+        for (unsigned int x = 0; x < width; ++x) {
+            std::memcpy(out + x * 4, &palette[counts[x]], 4);
+        }
+    };
+
+    int y_begin = std::max<int>(band * POST_BAND_ROWS, first_row);
+    int y_end = std::min<int>(std::min(height, last_row), band * POST_BAND_ROWS + POST_BAND_ROWS);
+    if (y_begin >= y_end) {
+        return;
+    }
+
+    if (!blur || height < 3 || width < 3) {
+        for (int y = y_begin; y < y_end; ++y) {
+            colorize_row(y, rgba + (y - first_row) * row_bytes);
+        }
+        return;
+    }
+
+    auto slot = [&](int y) { return ring + (y % 3) * row_bytes; };
+    if (y_begin > 0) colorize_row(y_begin - 1, slot(y_begin - 1));
+    colorize_row(y_begin, slot(y_begin));
+
+    for (int y = y_begin; y < y_end; ++y) {
+        if (y + 1 < static_cast<int>(height)) colorize_row(y + 1, slot(y + 1));
+        sf::Uint8* out = rgba + (y - first_row) * row_bytes;
+        if (y == 0 || y == static_cast<int>(height) - 1) {
+            std::memcpy(out, slot(y), row_bytes);
+            continue;
+        }
+        blur_row(slot(y - 1), slot(y), slot(y + 1), out, 1, width - 1);
+        std::memcpy(out, slot(y), 4);
+        std::memcpy(out + row_bytes - 4, slot(y) + row_bytes - 4, 4);
+    }
+}
+
+template <typename Count>
+void colorize_and_blur(const Count* iterations, unsigned int width, unsigned int height,
+    const std::vector<sf::Uint32>& palette, bool blur, sf::Uint8* rgba, int threads, BlurRowFn blur_row) {
+
+    int n_bands = (height + POST_BAND_ROWS - 1) / POST_BAND_ROWS;
+    #pragma omp parallel num_threads(threads)
+    {
+        std::vector<sf::Uint8> ring(3 * static_cast<size_t>(width) * 4);
+
+        #pragma omp for schedule(static)
+        for (int band = 0; band < n_bands; ++band) {
+            process_band(iterations, width, height, palette, blur, rgba, band, ring.data(), blur_row);
+        }
+    }
+}
+
+}
+
 
 double JuliaSetCalculator::map(double value, double in_min, double in_max, double out_min, double out_max) {
     return (value - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
@@ -17,13 +93,88 @@ void JuliaSetCalculator::setTheme(int themeID) {
     }
 }
 
+std::vector<sf::Color> JuliaSetCalculator::buildPalette(int max_iterations) {
+    return buildPalette(max_iterations, Theme);
+}
+
+std::vector<sf::Color> JuliaSetCalculator::buildPalette(int max_iterations, int theme) {
+    std::vector<sf::Color> palette(max_iterations + 1);
+    for (int n = 0; n <= max_iterations; ++n) {
+        palette[n] = PixelArtist(n, max_iterations, theme);
+    }
+    return palette;
+}
+
+void JuliaSetCalculator::setBlur(bool enabled) {
+    this->Blur = enabled;
+}
+
+void JuliaSetCalculator::blur_row(const sf::Uint8* above, const sf::Uint8* row, const sf::Uint8* below, sf::Uint8* out,
+    int x_begin, int x_end) {
+    // plain byte loop over all four channels so it vectorizes; alpha is selected back afterwards
+    #pragma omp simd
+    for (int i = x_begin * 4; i < x_end * 4; ++i) {
+        unsigned short sum = above[i] + below[i] + row[i] + row[i - 4] + row[i + 4];
+        out[i] = ((i & 3) == 3) ? row[i] : static_cast<sf::Uint8>(sum / 5);
+    }
+}
+
+std::vector<sf::Uint32> JuliaSetCalculator::buildPackedPalette(int max_iterations) {
+    return buildPackedPalette(max_iterations, Theme);
+}
+
+std::vector<sf::Uint32> JuliaSetCalculator::buildPackedPalette(int max_iterations, int theme) {
+    std::vector<sf::Color> colors = buildPalette(max_iterations, theme);
+    std::vector<sf::Uint32> palette(colors.size());
+    std::memcpy(palette.data(), colors.data(), colors.size() * 4);
+    return palette;
+}
+
+void JuliaSetCalculator::post_process(const sf::Uint16* iterations, unsigned int width, unsigned int height,
+    int max_iterations, sf::Uint8* rgba, int threads) {
+    colorize_and_blur(iterations, width, height, buildPackedPalette(max_iterations), Blur, rgba, threads,
+        &JuliaSetCalculator::blur_row);
+}
+
+void JuliaSetCalculator::post_process(const sf::Uint8* iterations, unsigned int width, unsigned int height,
+    int max_iterations, sf::Uint8* rgba, int threads) {
+    colorize_and_blur(iterations, width, height, buildPackedPalette(max_iterations), Blur, rgba, threads,
+        &JuliaSetCalculator::blur_row);
+}
+
+int JuliaSetCalculator::post_process_bands(unsigned int height) {
+    return (height + POST_BAND_ROWS - 1) / POST_BAND_ROWS;
+}
+
+unsigned int JuliaSetCalculator::post_process_band_rows() {
+    return POST_BAND_ROWS;
+}
+
+void JuliaSetCalculator::post_process_band(const sf::Uint16* iterations, unsigned int width, unsigned int height,
+    const std::vector<sf::Uint32>& palette, sf::Uint8* rgba, int band) {
+    std::vector<sf::Uint8> ring(3 * static_cast<size_t>(width) * 4);
+    process_band(iterations, width, height, palette, Blur, rgba, band, ring.data(), &JuliaSetCalculator::blur_row);
+}
+
+void JuliaSetCalculator::post_process_band(const sf::Uint16* iterations, unsigned int width, unsigned int height,
+    const std::vector<sf::Uint32>& palette, sf::Uint8* rgba, int band,
+    unsigned int counts_row, unsigned int first_row, unsigned int last_row) {
+    std::vector<sf::Uint8> ring(3 * static_cast<size_t>(width) * 4);
+    process_band(iterations, width, height, palette, Blur, rgba, band, ring.data(), &JuliaSetCalculator::blur_row,
+        counts_row, first_row, last_row);
+}
+
 sf::Color JuliaSetCalculator::PixelArtist(int n, int max_iterations) {
+    return PixelArtist(n, max_iterations, this->Theme);
+}
+
+sf::Color JuliaSetCalculator::PixelArtist(int n, int max_iterations, int theme) {
     if (n == max_iterations) {
         return sf::Color::Black;
     }
 
     // Theme ROULETTE :D
-    switch (this->Theme) {
+    switch (theme) {
         
         // Theme 1: RGB
         case 1: 
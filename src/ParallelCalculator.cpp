@@ -1,12 +1,24 @@
 #include "../headers/ParallelCalculator.hpp"
+#include "../headers/CpuBudget.hpp"
 #include <cmath>
 #include <stdlib.h>
 #include <omp.h>
 #include <mpi.h>
 #include <vector>
+#include <functional>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+#include <iomanip>
 #include<iostream>
 
-ParallelCalculator::ParallelCalculator() : JuliaSetCalculator(), scheduleType("static"), numThreads(0) {}
+ParallelCalculator::ParallelCalculator() : JuliaSetCalculator(), scheduleType("static"), numThreads(0), scheduler(nullptr), sharedMemory(false), gatherFormat("rgba"), decomposition("rows"),
+    nodeComm(MPI_COMM_NULL), leaderComm(MPI_COMM_NULL), frameWindow(MPI_WIN_NULL), frameBase(nullptr), frameWindowBytes(0) {}
+
+ParallelCalculator::~ParallelCalculator() {
+    releaseSharedWindow();
+}
 
 void ParallelCalculator::setSchedule(const std::string& schedule) {
     scheduleType = schedule;
@@ -24,15 +36,63 @@ int ParallelCalculator::getNumThreads() const {
     return numThreads;
 }
 
-void ParallelCalculator::calculate_pixel(unsigned int px, unsigned int py, sf::Image& image, const std::complex<double>& c_constant, 
-    int max_iterations, int poly_degree,
-    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
-    
-    unsigned int width = image.getSize().x;
-    unsigned int height = image.getSize().y;
+void ParallelCalculator::setScheduler(TileScheduler* shared) {
+    scheduler = shared;
+}
+
+TileScheduler* ParallelCalculator::getScheduler() const {
+    return scheduler;
+}
+
+void ParallelCalculator::setSharedMemory(bool enabled) {
+    sharedMemory = enabled;
+}
+
+bool ParallelCalculator::getSharedMemory() const {
+    return sharedMemory;
+}
+
+void ParallelCalculator::setGatherFormat(const std::string& format) {
+    gatherFormat = format;
+}
+
+std::string ParallelCalculator::getGatherFormat() const {
+    return gatherFormat;
+}
+
+void ParallelCalculator::setDecomposition(const std::string& mode) {
+    decomposition = mode;
+}
+
+std::string ParallelCalculator::getDecomposition() const {
+    return decomposition;
+}
+
+// Picks the blocks-per-column x blocks-per-row grid that gives each rank the least halo to receive.
+// Wide images end up split into columns, tall ones into rows, and slivers are avoided.
+void ParallelCalculator::choose_grid(int n_ranks, unsigned int width, unsigned int height, int dims[2]) {
+    double best = -1.0;
+    dims[0] = n_ranks;
+    dims[1] = 1;
+    for (int cols = 1; cols <= n_ranks; ++cols) {
+        if (n_ranks % cols != 0) continue;
+        int rows = n_ranks / cols;
+        if (static_cast<unsigned int>(rows) > height || static_cast<unsigned int>(cols) > width) continue;
+
+        double block_w = static_cast<double>(width) / cols;
+        double block_h = static_cast<double>(height) / rows;
+        double halo = (rows > 1 ? 2.0 * block_w : 0.0) + (cols > 1 ? 2.0 * block_h : 0.0);
+        if (best < 0.0 || halo < best) {
+            best = halo;
+            dims[0] = rows;
+            dims[1] = cols;
+        }
+    }
+}
+
+int ParallelCalculator::escape_time(double x0, double y0, const std::complex<double>& c_constant,
+    int max_iterations, int poly_degree) {
 
-    double x0 = map(px, 0, width, view_x_min, view_x_max);
-    double y0 = map(py, 0, height, view_y_min, view_y_max);
     std::complex<double> z(x0, y0);
 
     int iteration = 0;
@@ -51,8 +111,19 @@ void ParallelCalculator::calculate_pixel(unsigned int px, unsigned int py, sf::I
         z = z_next;
         iteration++;
     }
-    sf::Color color = PixelArtist(iteration, max_iterations);
-    image.setPixel(px, py, color);
+    return iteration;
+}
+
+void ParallelCalculator::calculate_pixel(unsigned int px, unsigned int py, unsigned int width, unsigned int height,
+    sf::Uint16* iterations, const std::complex<double>& c_constant, 
+    int max_iterations, int poly_degree,
+    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
+
+    double x0 = map(px, 0, width, view_x_min, view_x_max);
+    double y0 = map(py, 0, height, view_y_min, view_y_max);
+
+    iterations[static_cast<size_t>(py) * width + px] =
+        static_cast<sf::Uint16>(escape_time(x0, y0, c_constant, max_iterations, poly_degree));
 }
 
 // this function doesnt return anything, it simply sets the pixel color based on the number of iterations
@@ -61,29 +132,40 @@ double ParallelCalculator::calculate_polynomial(sf::Image& image, const std::com
     double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
         // unsigned because they have more range for image dimensions since removing the sign bit allows for an extra bit of magnitude :D 
 
-    if (numThreads > 0) {
-        omp_set_num_threads(numThreads);
-    } else {
-        omp_set_num_threads(omp_get_max_threads());
+    if (max_iterations > 65535) {
+        std::cerr << "Warning: max_iterations capped at 65535." << std::endl;
+        max_iterations = 65535;
     }
+    if (scheduler) {
+        std::vector<FrameJob> frame{{&image, c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max}};
+        return calculate_batch(frame);
+    }
+
+    // an unset thread count means the CPUs the container actually grants, not the host's core count
+    int threads = (numThreads > 0) ? numThreads : CpuBudget::threads();
+    omp_set_num_threads(threads);
 
     unsigned int width = image.getSize().x;
     unsigned int height = image.getSize().y;
         // Iterate over each pixel in the image
     long double start_time = omp_get_wtime();
 
+    // counts first, row by row, then one fused colorize + blur pass over them
+    std::vector<sf::Uint16> iterations(static_cast<size_t>(width) * height);
+    sf::Uint16* counts = iterations.data();
+
     if (scheduleType == "dynamic") {
         #pragma omp parallel for collapse(2) schedule(dynamic)
-        for (unsigned int px = 0; px < width; ++px) {
-            for (unsigned int py = 0; py < height; ++py) {
-                calculate_pixel(px, py, image, c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
+        for (unsigned int py = 0; py < height; ++py) {
+            for (unsigned int px = 0; px < width; ++px) {
+                calculate_pixel(px, py, width, height, counts, c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
             }
         }
     } else if (scheduleType == "guided") {
         #pragma omp parallel for collapse(2) schedule(guided)
-        for (unsigned int px = 0; px < width; ++px) {
-            for (unsigned int py = 0; py < height; ++py) {
-                calculate_pixel(px, py, image, c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
+        for (unsigned int py = 0; py < height; ++py) {
+            for (unsigned int px = 0; px < width; ++px) {
+                calculate_pixel(px, py, width, height, counts, c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
             }
         }
     } else { // Default to static
@@ -92,44 +174,206 @@ double ParallelCalculator::calculate_polynomial(sf::Image& image, const std::com
             scheduleType = "static";
         }
         #pragma omp parallel for collapse(2) schedule(static)
-        for (unsigned int px = 0; px < width; ++px) {
-            for (unsigned int py = 0; py < height; ++py) {
-                calculate_pixel(px, py, image, c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
+        for (unsigned int py = 0; py < height; ++py) {
+            for (unsigned int px = 0; px < width; ++px) {
+                calculate_pixel(px, py, width, height, counts, c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
             }
         }
     }
 
+    std::vector<sf::Uint8> pixels(static_cast<size_t>(width) * height * 4);
+    post_process(counts, width, height, max_iterations, pixels.data(), threads);
+    image.create(width, height, pixels.data());
+
     long double end_time = omp_get_wtime();
     long double elapsed_time = end_time - start_time;
     std::cout<<"Calculation took "<< elapsed_time <<" seconds\n";
     return elapsed_time;
 }
 
+double ParallelCalculator::estimate_iterations(const FrameJob& frame, unsigned int samples) {
+    sf::Vector2u size = frame.image ? frame.image->getSize() : sf::Vector2u(frame.width, frame.height);
+    if (size.x == 0 || size.y == 0 || samples == 0) {
+        return 0.0;
+    }
+    int max_iterations = std::min(frame.max_iterations, 65535);
+    double total = 0.0;
+    for (unsigned int sy = 0; sy < samples; ++sy) {
+        // the centres of a samples x samples grid of cells, so thin frames are covered evenly too
+        double y0 = map((sy + 0.5) * size.y / samples, 0, size.y, frame.view_y_min, frame.view_y_max);
+        for (unsigned int sx = 0; sx < samples; ++sx) {
+            double x0 = map((sx + 0.5) * size.x / samples, 0, size.x, frame.view_x_min, frame.view_x_max);
+            // + 1 for the pixel's own colouring and blur
+            total += escape_time(x0, y0, frame.c_constant, max_iterations, frame.poly_degree) + 1;
+        }
+    }
+    return total / (static_cast<double>(samples) * samples) * size.x * size.y;
+}
+
+// All frames of the batch are cut into post-process bands and go through the shared TileScheduler as
+// one job, so small frames fill the pool together; every tile is computed first, then coloured and blurred.
+double ParallelCalculator::calculate_batch(std::vector<FrameJob>& frames) {
+    // without a scheduler the tiles go to an OpenMP team instead
+    int threads = (numThreads > 0) ? numThreads : CpuBudget::threads();
+    auto run_tiles = [&](int n_tiles, const std::function<void(int)>& task) {
+        if (scheduler) {
+            scheduler->run(n_tiles, task);
+            return;
+        }
+        #pragma omp parallel for schedule(dynamic) num_threads(threads)
+        for (int t = 0; t < n_tiles; ++t) {
+            task(t);
+        }
+    };
+
+    double start_time = omp_get_wtime();
+    const unsigned int band_rows = post_process_band_rows();
+
+    // counts go to the caller's buffer when it gives one, so pooled buffers are not reallocated
+    std::vector<std::vector<sf::Uint16>> own_counts(frames.size());
+    std::vector<sf::Uint16*> counts(frames.size());
+    std::vector<sf::Vector2u> sizes(frames.size());
+    // rows [first, last) are wanted; counts cover [counts_first, counts_last), which adds the rows
+    // either side that the blur reads when the frame is coloured
+    std::vector<unsigned int> first(frames.size()), last(frames.size());
+    std::vector<unsigned int> counts_first(frames.size()), counts_last(frames.size());
+    std::vector<unsigned int> step(frames.size());
+    // (frame, first row) of every compute tile
+    std::vector<std::pair<size_t, unsigned int>> tiles;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        FrameJob& f = frames[i];
+        if (f.max_iterations > 65535) {
+            std::cerr << "Warning: max_iterations capped at 65535." << std::endl;
+            f.max_iterations = 65535;
+        }
+        sizes[i] = f.image ? f.image->getSize() : sf::Vector2u(f.width, f.height);
+        step[i] = std::max(1u, f.step);
+        bool window = !f.image && f.rows > 0;
+        first[i] = window ? std::min(f.first_row, sizes[i].y) : 0;
+        last[i] = window ? std::min(sizes[i].y, f.first_row + f.rows) : sizes[i].y;
+        bool coloured = f.image || f.pixels;
+        counts_first[i] = (coloured && first[i] > 0) ? first[i] - 1 : first[i];
+        counts_last[i] = (coloured && last[i] < sizes[i].y) ? last[i] + 1 : last[i];
+        std::vector<sf::Uint16>& buffer = f.counts ? *f.counts : own_counts[i];
+        buffer.resize(static_cast<size_t>(sizes[i].x) * (counts_last[i] - counts_first[i]));
+        counts[i] = buffer.data();
+        for (unsigned int row = counts_first[i]; row < counts_last[i]; row += band_rows) {
+            tiles.emplace_back(i, row);
+        }
+    }
+
+    run_tiles(static_cast<int>(tiles.size()), [&](int t) {
+        size_t i = tiles[t].first;
+        const FrameJob& f = frames[i];
+        unsigned int width = sizes[i].x;
+        unsigned int height = sizes[i].y;
+        unsigned int y_end = std::min(counts_last[i], tiles[t].second + band_rows);
+        for (unsigned int py = tiles[t].second; py < y_end; ++py) {
+            if (f.stopped()) {
+                return;
+            }
+            if (py % step[i] != 0) {
+                continue;
+            }
+            sf::Uint16* row = counts[i] + static_cast<size_t>(py - counts_first[i]) * width;
+            double y0 = map(py, 0, height, f.view_y_min, f.view_y_max);
+            // pixels an earlier pass already computed; done_step is a multiple of step
+            unsigned int skip = (f.done_step > 0 && py % f.done_step == 0) ? f.done_step : 0;
+            for (unsigned int px = 0; px < width; px += step[i]) {
+                if (skip && px % skip == 0) {
+                    continue;
+                }
+                double x0 = map(px, 0, width, f.view_x_min, f.view_x_max);
+                row[px] = static_cast<sf::Uint16>(escape_time(x0, y0, f.c_constant, f.max_iterations, f.poly_degree));
+            }
+        }
+    });
+
+    // frames with nowhere to put colour skip colouring altogether; images get a staging buffer
+    std::vector<std::vector<sf::Uint8>> staging(frames.size());
+    std::vector<sf::Uint8*> pixels(frames.size(), nullptr);
+    std::vector<std::vector<sf::Uint32>> palettes(frames.size());
+    // (frame, post-process band) of every colour tile
+    std::vector<std::pair<size_t, int>> colour_tiles;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (frames[i].image) {
+            staging[i].resize(static_cast<size_t>(sizes[i].x) * sizes[i].y * 4);
+            pixels[i] = staging[i].data();
+        } else {
+            pixels[i] = frames[i].pixels;
+        }
+        if (pixels[i]) {
+            palettes[i] = buildPackedPalette(frames[i].max_iterations, frames[i].theme > 0 ? frames[i].theme : Theme);
+        }
+    }
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (!pixels[i] || step[i] > 1 || first[i] == last[i] || frames[i].stopped()) {
+            continue;
+        }
+        for (unsigned int band = first[i] / band_rows; band * band_rows < last[i]; ++band) {
+            colour_tiles.emplace_back(i, static_cast<int>(band));
+        }
+    }
+    run_tiles(static_cast<int>(colour_tiles.size()), [&](int t) {
+        size_t i = colour_tiles[t].first;
+        post_process_band(counts[i], sizes[i].x, sizes[i].y, palettes[i], pixels[i], colour_tiles[t].second,
+            counts_first[i], first[i], last[i]);
+    });
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (frames[i].image) {
+            frames[i].image->create(sizes[i].x, sizes[i].y, staging[i].data());
+        }
+    }
 
-void ParallelCalculator::apply_blur(std::vector<sf::Uint8>& buffer, int width, int start_row, int end_row) {
-    std::vector<sf::Uint8> read_buffer = buffer;
+    double elapsed_time = omp_get_wtime() - start_time;
+    std::cout<<"Calculation took "<< elapsed_time <<" seconds\n";
+    return elapsed_time;
+}
 
-    for (int y = start_row; y < end_row; ++y) {
-        for (int x = 1; x < width - 1; ++x) {
-            int center_idx = (y * width + x) * 4;
 
-            int r = 0, g = 0, b = 0;
-            int count = 0;
+// Blurs rows [start_row, end_row) of a buffer whose neighbour rows sit right above and below the range.
+void ParallelCalculator::apply_blur(std::vector<sf::Uint8>& buffer, int width, int start_row, int end_row, int start_col, int end_col) {
+    if (end_row <= start_row) return;
+    size_t row_bytes = static_cast<size_t>(width) * 4;
+    apply_blur(&buffer[start_row * row_bytes], width, end_row - start_row,
+               &buffer[(start_row - 1) * row_bytes], &buffer[end_row * row_bytes], start_col, end_col);
+}
 
-            int offsets[] = {0, -width, width, -1, 1};
+// Blurs `count` contiguous rows in place; `above` and `below` are the unblurred rows bordering them and may
+// live anywhere. Only unblurred copies of the row above and the current row are kept, so a call costs two
+// row copies instead of a copy of the whole range.
+void ParallelCalculator::apply_blur(sf::Uint8* rows, int width, int count, const sf::Uint8* above, const sf::Uint8* below,
+    int start_col, int end_col) {
+    if (count <= 0) return;
+    if (end_col < 0) end_col = width - 1;
+    size_t row_bytes = static_cast<size_t>(width) * 4;
+
+    std::vector<sf::Uint8> previous(above, above + row_bytes);
+    std::vector<sf::Uint8> current(row_bytes);
+
+    for (int y = 0; y < count; ++y) {
+        sf::Uint8* row = rows + y * row_bytes;
+        const sf::Uint8* next = (y + 1 < count) ? row + row_bytes : below;
+        std::memcpy(current.data(), row, row_bytes);
+        blur_row(previous.data(), current.data(), next, row, start_col, end_col);
+        std::swap(previous, current);
+    }
+}
 
-            for (int k = 0; k < 5; ++k) {
-                int neighbor_idx = center_idx + (offsets[k] * 4);
-                r += read_buffer[neighbor_idx];
-                g += read_buffer[neighbor_idx + 1];
-                b += read_buffer[neighbor_idx + 2];
-                count++;
-            }
+void ParallelCalculator::calculate_row(unsigned int py, unsigned int x_begin, unsigned int x_end,
+    unsigned int width, unsigned int height, sf::Uint8* row,
+    const std::complex<double>& c_constant, int max_iterations, int poly_degree,
+    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
 
-            buffer[center_idx]     = r / count;
-            buffer[center_idx + 1] = g / count;
-            buffer[center_idx + 2] = b / count;
-        }
+    double y0 = map(py, 0, height, view_y_min, view_y_max);
+    for (unsigned int px = x_begin; px < x_end; ++px) {
+        double x0 = map(px, 0, width, view_x_min, view_x_max);
+        int iteration = escape_time(x0, y0, c_constant, max_iterations, poly_degree);
+        sf::Color c = PixelArtist(iteration, max_iterations);
+        *row++ = c.r;
+        *row++ = c.g;
+        *row++ = c.b;
+        *row++ = c.a;
     }
 }
 
@@ -138,71 +382,105 @@ void ParallelCalculator::calculate_distributed(int rank, int n_ranks, sf::Image&
     int max_iterations, int poly_degree,
     double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
 
+    // counts are 16-bit in every mode, as in the other engines
+    if (max_iterations > 65535) {
+        if (rank == 0) std::cerr << "Warning: max_iterations capped at 65535." << std::endl;
+        max_iterations = 65535;
+    }
+    if (sharedMemory) {
+        if (gatherFormat != "rgba" || decomposition != "rows") {
+            if (rank == 0) {
+                std::cerr << "Warning: The shared-memory frame ignores gather format '" << gatherFormat
+                          << "' and decomposition '" << decomposition << "'." << std::endl;
+            }
+            gatherFormat = "rgba";
+            decomposition = "rows";
+        }
+        calculate_distributed_shared(rank, n_ranks, image, c_constant, max_iterations, poly_degree,
+                                     view_x_min, view_x_max, view_y_min, view_y_max);
+        return;
+    }
+    if (gatherFormat == "iter16" || gatherFormat == "palette8") {
+        if (decomposition != "rows") {
+            if (rank == 0) {
+                std::cerr << "Warning: The " << gatherFormat << " gather splits the frame into rows and ignores decomposition '"
+                          << decomposition << "'." << std::endl;
+            }
+            decomposition = "rows";
+        }
+        calculate_distributed_compact(rank, n_ranks, image, c_constant, max_iterations, poly_degree,
+                                      view_x_min, view_x_max, view_y_min, view_y_max);
+        return;
+    } else if (gatherFormat != "rgba") {
+        std::cerr << "Warning: Unknown gather format '" << gatherFormat << "'. Defaulting to 'rgba'." << std::endl;
+        gatherFormat = "rgba";
+    }
+
     unsigned int width = (rank == 0) ? image.getSize().x : 0;
     unsigned int height = (rank == 0) ? image.getSize().y : 0;
     MPI_Bcast(&width, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
     MPI_Bcast(&height, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
 
+    if (decomposition == "cart" || decomposition == "auto") {
+        int dims[2] = {0, 0}; // {blocks down, blocks across}
+        if (decomposition == "cart") {
+            MPI_Dims_create(n_ranks, 2, dims);
+            if (width > height) std::swap(dims[0], dims[1]);
+            // more blocks than pixels along a side would leave ranks with empty blocks
+            if (static_cast<unsigned int>(dims[0]) > height || static_cast<unsigned int>(dims[1]) > width) {
+                if (rank == 0) {
+                    std::cerr << "Warning: A " << dims[0] << "x" << dims[1] << " grid does not fit a " << width << "x"
+                              << height << " frame. Choosing one that does, or row bands if none fits." << std::endl;
+                }
+                choose_grid(n_ranks, width, height, dims);
+            }
+        } else {
+            choose_grid(n_ranks, width, height, dims);
+        }
+        // choose_grid returns a single column when no grid fits, which the row bands handle
+        bool fits = static_cast<unsigned int>(dims[0]) <= height && static_cast<unsigned int>(dims[1]) <= width;
+        if (fits && (decomposition == "cart" || dims[1] > 1)) {
+            calculate_distributed_cart(rank, n_ranks, image, width, height, dims, c_constant, max_iterations, poly_degree,
+                                       view_x_min, view_x_max, view_y_min, view_y_max);
+            return;
+        }
+    } else if (decomposition != "rows") {
+        std::cerr << "Warning: Unknown decomposition '" << decomposition << "'. Defaulting to 'rows'." << std::endl;
+        decomposition = "rows";
+    }
+
     int rows_per_rank = height / n_ranks;
     int remainder = height % n_ranks;
     int my_rows = rows_per_rank + (rank < remainder ? 1 : 0);
     int my_start_y = rank * rows_per_rank + (rank < remainder ? rank : remainder);
     int my_end_y = my_start_y + my_rows;
 
-    std::vector<sf::Uint8> local_buffer((my_rows + 2) * width * 4);
-    int pixel_offset = width * 4;
+    // counts for our rows plus the row either side that the blur reads; the halo rows are computed here
+    // rather than exchanged, so colouring and blurring is the same fused pass the other engines use
+    int counts_start = std::max(0, my_start_y - 1);
+    int counts_end = std::min(static_cast<int>(height), my_end_y + 1);
+    std::vector<sf::Uint16> counts(static_cast<size_t>(std::max(0, counts_end - counts_start)) * width);
 
-    for (unsigned int py = my_start_y; py < my_end_y; ++py) {
+    for (int py = counts_start; py < counts_end; ++py) {
+        double y0 = map(py, 0, height, view_y_min, view_y_max);
+        sf::Uint16* row = &counts[static_cast<size_t>(py - counts_start) * width];
         for (unsigned int px = 0; px < width; ++px) {
             double x0 = map(px, 0, width, view_x_min, view_x_max);
-            double y0 = map(py, 0, height, view_y_min, view_y_max);
-            std::complex<double> z(x0, y0);
-            int iteration = 0;
-            while (iteration < max_iterations) {
-                std::complex<double> z_next;
-                if (poly_degree == 2) z_next = z * z + c_constant;
-                else z_next = std::pow(z, poly_degree) + c_constant;
-               
-                if (std::norm(z_next) > 4.0) break;
-                z = z_next;
-                iteration++;
-            }
-            sf::Color c = PixelArtist(iteration, max_iterations);
-            local_buffer[pixel_offset++] = c.r;
-            local_buffer[pixel_offset++] = c.g;
-            local_buffer[pixel_offset++] = c.b;
-            local_buffer[pixel_offset++] = c.a;
+            row[px] = static_cast<sf::Uint16>(escape_time(x0, y0, c_constant, max_iterations, poly_degree));
         }
     }
-   
-    MPI_Request requests[4] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL};
-    int req_count = 0;
 
-    sf::Uint8* my_top_row    = &local_buffer[width * 4];
-    sf::Uint8* my_bottom_row = &local_buffer[my_rows * width * 4];
-    sf::Uint8* top_halo      = &local_buffer[0];
-    sf::Uint8* bottom_halo   = &local_buffer[(my_rows + 1) * width * 4];
-
-    if (rank > 0) {
-        MPI_Irecv(top_halo, width * 4, MPI_UNSIGNED_CHAR, rank - 1, 0, MPI_COMM_WORLD, &requests[req_count++]);
-        MPI_Isend(my_top_row, width * 4, MPI_UNSIGNED_CHAR, rank - 1, 1, MPI_COMM_WORLD, &requests[req_count++]);
-    }
-
-    if (rank < n_ranks - 1) {
-        MPI_Irecv(bottom_halo, width * 4, MPI_UNSIGNED_CHAR, rank + 1, 1, MPI_COMM_WORLD, &requests[req_count++]);
-        MPI_Isend(my_bottom_row, width * 4, MPI_UNSIGNED_CHAR, rank + 1, 0, MPI_COMM_WORLD, &requests[req_count++]);
-    }
-
-    if (my_rows > 2) {
-        apply_blur(local_buffer, width, 2, my_rows);
+    std::vector<sf::Uint8> local_buffer(static_cast<size_t>(my_rows) * width * 4);
+    if (my_rows > 0) {
+        std::vector<sf::Uint32> palette = buildPackedPalette(max_iterations);
+        int band_rows = static_cast<int>(post_process_band_rows());
+        for (int band = my_start_y / band_rows; band * band_rows < my_end_y; ++band) {
+            post_process_band(counts.data(), width, height, palette, local_buffer.data(), band,
+                              counts_start, my_start_y, my_end_y);
+        }
     }
 
-    MPI_Waitall(req_count, requests, MPI_STATUSES_IGNORE);
-
-    apply_blur(local_buffer, width, 1, 2);
-    apply_blur(local_buffer, width, my_rows, my_rows + 1);
-
-    sf::Uint8* send_ptr = &local_buffer[width * 4];
+    sf::Uint8* send_ptr = local_buffer.data();
     int send_count = my_rows * width * 4;
 
     if (rank == 0) {
@@ -210,7 +488,7 @@ void ParallelCalculator::calculate_distributed(int rank, int n_ranks, sf::Image&
         std::vector<int> displs(n_ranks);
         int current_disp = 0;
         for (int i = 0; i < n_ranks; ++i) {
-            int r_rows = (height / n_ranks) + (i < (height % n_ranks) ? 1 : 0);
+            int r_rows = rows_per_rank + (i < remainder ? 1 : 0);
             recv_counts[i] = r_rows * width * 4;
             displs[i] = current_disp;
             current_disp += recv_counts[i];
@@ -227,4 +505,501 @@ void ParallelCalculator::calculate_distributed(int rank, int n_ranks, sf::Image&
                     NULL, NULL, NULL, MPI_UNSIGNED_CHAR,
                     0, MPI_COMM_WORLD);
     }
-}
\ No newline at end of file
+}
+void ParallelCalculator::releaseSharedWindow() {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized) {
+        return; // MPI already released the window and communicators
+    }
+    if (frameWindow != MPI_WIN_NULL) MPI_Win_free(&frameWindow);
+    if (leaderComm != MPI_COMM_NULL) MPI_Comm_free(&leaderComm);
+    if (nodeComm != MPI_COMM_NULL) MPI_Comm_free(&nodeComm);
+    frameBase = nullptr;
+    frameWindowBytes = 0;
+}
+
+// Ranks on the same node write their rows straight into one MPI_Win_allocate_shared frame owned by the
+// node leader. Halo rows for the blur are read directly from the neighbours' rows in that frame, so only
+// the rows on node boundaries travel as messages, and only node leaders take part in the final gather.
+void ParallelCalculator::calculate_distributed_shared(int rank, int n_ranks, sf::Image& image,
+    const std::complex<double>& c_constant,
+    int max_iterations, int poly_degree,
+    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
+
+    unsigned int width = (rank == 0) ? image.getSize().x : 0;
+    unsigned int height = (rank == 0) ? image.getSize().y : 0;
+    MPI_Bcast(&width, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&height, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+
+    if (nodeComm == MPI_COMM_NULL) {
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+        int node_rank;
+        MPI_Comm_rank(nodeComm, &node_rank);
+        MPI_Comm_split(MPI_COMM_WORLD, node_rank == 0 ? 0 : MPI_UNDEFINED, rank, &leaderComm);
+    }
+    int node_rank, node_size;
+    MPI_Comm_rank(nodeComm, &node_rank);
+    MPI_Comm_size(nodeComm, &node_size);
+
+    // number the ranks node by node so that every node owns one contiguous band of rows
+    int node_info[3] = {0, 0, 1}; // first slot of this node, node index, node count
+    if (leaderComm != MPI_COMM_NULL) {
+        MPI_Exscan(&node_size, &node_info[0], 1, MPI_INT, MPI_SUM, leaderComm);
+        MPI_Comm_rank(leaderComm, &node_info[1]);
+        MPI_Comm_size(leaderComm, &node_info[2]);
+        if (node_info[1] == 0) node_info[0] = 0;
+    }
+    MPI_Bcast(node_info, 3, MPI_INT, 0, nodeComm);
+    int node_first = node_info[0];
+    int node_index = node_info[1];
+    int n_nodes = node_info[2];
+
+    int rows_per_rank = height / n_ranks;
+    int remainder = height % n_ranks;
+    auto band_start = [&](int slot) { return slot * rows_per_rank + std::min(slot, remainder); };
+
+    int slot = node_first + node_rank;
+    int my_start_y = band_start(slot);
+    int my_end_y = band_start(slot + 1);
+    int my_rows = my_end_y - my_start_y;
+    int node_start_y = band_start(node_first);
+    int node_rows = band_start(node_first + node_size) - node_start_y;
+    size_t row_bytes = static_cast<size_t>(width) * 4;
+
+    // window layout: [top halo][node rows...][bottom halo], all owned by the node leader
+    size_t needed = (node_rows + 2) * row_bytes;
+    if (frameWindow == MPI_WIN_NULL || frameWindowBytes != needed) {
+        if (frameWindow != MPI_WIN_NULL) MPI_Win_free(&frameWindow);
+        void* base = nullptr;
+        MPI_Aint local_bytes = (node_rank == 0) ? static_cast<MPI_Aint>(needed) : 0;
+        MPI_Win_allocate_shared(local_bytes, 1, MPI_INFO_NULL, nodeComm, &base, &frameWindow);
+        MPI_Aint leader_bytes;
+        int disp_unit;
+        MPI_Win_shared_query(frameWindow, 0, &leader_bytes, &disp_unit, &base);
+        frameBase = static_cast<sf::Uint8*>(base);
+        frameWindowBytes = needed;
+    }
+    sf::Uint8* band = frameBase + row_bytes;
+    sf::Uint8* my_rows_ptr = band + (my_start_y - node_start_y) * row_bytes;
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, frameWindow);
+
+    for (int py = my_start_y; py < my_end_y; ++py) {
+        calculate_row(py, 0, width, width, height, my_rows_ptr + (py - my_start_y) * row_bytes,
+                      c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
+    }
+
+    MPI_Win_sync(frameWindow);
+    MPI_Barrier(nodeComm);
+    MPI_Win_sync(frameWindow);
+
+    // only the rows on node boundaries have to be exchanged, and only between leaders
+    if (leaderComm != MPI_COMM_NULL && n_nodes > 1) {
+        MPI_Request requests[4] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+        int req_count = 0;
+        sf::Uint8* top_halo = frameBase;
+        sf::Uint8* bottom_halo = band + node_rows * row_bytes;
+
+        if (node_index > 0) {
+            MPI_Irecv(top_halo, row_bytes, MPI_UNSIGNED_CHAR, node_index - 1, 0, leaderComm, &requests[req_count++]);
+            MPI_Isend(band, row_bytes, MPI_UNSIGNED_CHAR, node_index - 1, 1, leaderComm, &requests[req_count++]);
+        }
+        if (node_index < n_nodes - 1) {
+            MPI_Irecv(bottom_halo, row_bytes, MPI_UNSIGNED_CHAR, node_index + 1, 1, leaderComm, &requests[req_count++]);
+            MPI_Isend(bottom_halo - row_bytes, row_bytes, MPI_UNSIGNED_CHAR, node_index + 1, 0, leaderComm, &requests[req_count++]);
+        }
+        MPI_Waitall(req_count, requests, MPI_STATUSES_IGNORE);
+    }
+
+    MPI_Win_sync(frameWindow);
+    MPI_Barrier(nodeComm);
+    MPI_Win_sync(frameWindow);
+
+    // the first and last frame rows stay unblurred, so they can serve as their own neighbours in place
+    int first = (my_start_y == 0) ? 1 : 0;
+    int last = (my_end_y == static_cast<int>(height)) ? my_rows - 1 : my_rows;
+    const sf::Uint8* above = (first == 0) ? my_rows_ptr - row_bytes : my_rows_ptr;
+    const sf::Uint8* below = my_rows_ptr + last * row_bytes;
+
+    // rows owned by a neighbour rank get blurred by it, so snapshot just those two before anyone starts
+    std::vector<sf::Uint8> halos(2 * row_bytes);
+    if (Blur && last > first) {
+        if (first == 0) {
+            std::memcpy(halos.data(), above, row_bytes);
+            above = halos.data();
+        }
+        if (last == my_rows) {
+            std::memcpy(&halos[row_bytes], below, row_bytes);
+            below = &halos[row_bytes];
+        }
+    }
+
+    // nobody may overwrite a row until every neighbour has read it
+    MPI_Barrier(nodeComm);
+
+    if (Blur && last > first) {
+        apply_blur(my_rows_ptr + first * row_bytes, width, last - first, above, below);
+    }
+
+    MPI_Win_sync(frameWindow);
+    MPI_Barrier(nodeComm);
+    MPI_Win_sync(frameWindow);
+
+    if (leaderComm != MPI_COMM_NULL) {
+        if (n_nodes == 1) {
+            image.create(width, height, band); // single node: the shared frame already is the image
+        } else {
+            int send_count = node_rows * row_bytes;
+            if (rank == 0) {
+                std::vector<int> recv_counts(n_nodes);
+                std::vector<int> displs(n_nodes);
+                MPI_Gather(&send_count, 1, MPI_INT, recv_counts.data(), 1, MPI_INT, 0, leaderComm);
+                int current_disp = 0;
+                for (int i = 0; i < n_nodes; ++i) {
+                    displs[i] = current_disp;
+                    current_disp += recv_counts[i];
+                }
+                std::vector<sf::Uint8> final_pixels(row_bytes * height);
+                MPI_Gatherv(band, send_count, MPI_UNSIGNED_CHAR,
+                            final_pixels.data(), recv_counts.data(), displs.data(), MPI_UNSIGNED_CHAR,
+                            0, leaderComm);
+                image.create(width, height, final_pixels.data());
+            } else {
+                MPI_Gather(&send_count, 1, MPI_INT, NULL, 1, MPI_INT, 0, leaderComm);
+                MPI_Gatherv(band, send_count, MPI_UNSIGNED_CHAR,
+                            NULL, NULL, NULL, MPI_UNSIGNED_CHAR,
+                            0, leaderComm);
+            }
+        }
+    }
+
+    MPI_Win_unlock_all(frameWindow);
+}
+
+// Ranks send iteration counts instead of RGBA: two bytes per pixel for iter16, one for palette8 (only
+// possible while every count fits a byte). Rank 0 colours and blurs them in the fused post-processing pass.
+void ParallelCalculator::calculate_distributed_compact(int rank, int n_ranks, sf::Image& image,
+    const std::complex<double>& c_constant,
+    int max_iterations, int poly_degree,
+    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
+
+    unsigned int width = (rank == 0) ? image.getSize().x : 0;
+    unsigned int height = (rank == 0) ? image.getSize().y : 0;
+    MPI_Bcast(&width, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&height, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+
+    int rows_per_rank = height / n_ranks;
+    int remainder = height % n_ranks;
+    int my_rows = rows_per_rank + (rank < remainder ? 1 : 0);
+    int my_start_y = rank * rows_per_rank + (rank < remainder ? rank : remainder);
+
+    bool one_byte = (gatherFormat == "palette8" && max_iterations <= 255);
+    if (gatherFormat == "palette8" && !one_byte && rank == 0) {
+        std::cerr << "Warning: " << max_iterations << " iterations do not fit palette8. Sending 16-bit counts." << std::endl;
+    }
+    MPI_Datatype count_type = one_byte ? MPI_UNSIGNED_CHAR : MPI_UNSIGNED_SHORT;
+
+    std::vector<sf::Uint16> counts16(one_byte ? 0 : static_cast<size_t>(my_rows) * width);
+    std::vector<sf::Uint8> counts8(one_byte ? static_cast<size_t>(my_rows) * width : 0);
+
+    for (int row = 0; row < my_rows; ++row) {
+        double y0 = map(my_start_y + row, 0, height, view_y_min, view_y_max);
+        for (unsigned int px = 0; px < width; ++px) {
+            double x0 = map(px, 0, width, view_x_min, view_x_max);
+            int iteration = escape_time(x0, y0, c_constant, max_iterations, poly_degree);
+            size_t idx = static_cast<size_t>(row) * width + px;
+            if (one_byte) counts8[idx] = static_cast<sf::Uint8>(iteration);
+            else counts16[idx] = static_cast<sf::Uint16>(iteration);
+        }
+    }
+
+    const void* send_ptr = one_byte ? static_cast<const void*>(counts8.data()) : static_cast<const void*>(counts16.data());
+    int send_count = my_rows * width;
+
+    if (rank != 0) {
+        MPI_Gatherv(send_ptr, send_count, count_type, NULL, NULL, NULL, count_type, 0, MPI_COMM_WORLD);
+        return;
+    }
+
+    std::vector<int> recv_counts(n_ranks);
+    std::vector<int> displs(n_ranks);
+    int current_disp = 0;
+    for (int i = 0; i < n_ranks; ++i) {
+        int r_rows = rows_per_rank + (i < remainder ? 1 : 0);
+        recv_counts[i] = r_rows * width;
+        displs[i] = current_disp;
+        current_disp += recv_counts[i];
+    }
+
+    size_t total = static_cast<size_t>(width) * height;
+    std::vector<sf::Uint16> all16(one_byte ? 0 : total);
+    std::vector<sf::Uint8> all8(one_byte ? total : 0);
+    void* recv_ptr = one_byte ? static_cast<void*>(all8.data()) : static_cast<void*>(all16.data());
+    MPI_Gatherv(send_ptr, send_count, count_type,
+                recv_ptr, recv_counts.data(), displs.data(), count_type,
+                0, MPI_COMM_WORLD);
+
+    std::vector<sf::Uint8> final_pixels(total * 4);
+    int threads = (numThreads > 0) ? numThreads : CpuBudget::threads();
+    if (one_byte) {
+        post_process(all8.data(), width, height, max_iterations, final_pixels.data(), threads);
+    } else {
+        post_process(all16.data(), width, height, max_iterations, final_pixels.data(), threads);
+    }
+    image.create(width, height, final_pixels.data());
+}
+
+// Collective MPI-IO output for frames that do not fit in one rank's memory. Each rank walks its band in
+// chunks of a few MB. The blur needs one row either side of a chunk: inside the band the last two rows of a
+// chunk are carried over as the start of the next one, and the rows just outside the band, which belong to
+// the neighbouring ranks, are computed again here instead of being exchanged.
+double ParallelCalculator::render_to_file(int rank, int n_ranks, unsigned int width, unsigned int height,
+    const std::string& path, const std::string& format,
+    const std::complex<double>& c_constant,
+    int max_iterations, int poly_degree,
+    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
+
+    bool ppm = (format == "ppm");
+    if (!ppm && format != "raw" && rank == 0) {
+        std::cerr << "Warning: Unknown output format '" << format << "'. Defaulting to 'raw'." << std::endl;
+    }
+    long double start_time = omp_get_wtime();
+
+    size_t channels = ppm ? 3 : 4;
+    std::string header = ppm ? "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n" : "";
+
+    int rows_per_rank = height / n_ranks;
+    int remainder = height % n_ranks;
+    int my_rows = rows_per_rank + (rank < remainder ? 1 : 0);
+    int my_start_y = rank * rows_per_rank + (rank < remainder ? rank : remainder);
+
+    MPI_File fh;
+    if (MPI_File_open(MPI_COMM_WORLD, path.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh) != MPI_SUCCESS) {
+        throw std::runtime_error("Could not open '" + path + "' for MPI-IO");
+    }
+    MPI_File_set_size(fh, static_cast<MPI_Offset>(header.size()) + static_cast<MPI_Offset>(width) * height * channels);
+    if (rank == 0 && !header.empty()) {
+        MPI_File_write_at(fh, 0, header.data(), header.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+    }
+
+    size_t row_bytes = static_cast<size_t>(width) * 4;
+    int chunk_rows = static_cast<int>(std::max<size_t>(1, (8u << 20) / row_bytes));
+    // write_at_all is collective, so every rank goes through the same number of chunks
+    int max_rows = rows_per_rank + (remainder > 0 ? 1 : 0);
+    int n_chunks = (max_rows + chunk_rows - 1) / chunk_rows;
+    int threads = (numThreads > 0) ? numThreads : CpuBudget::threads();
+
+    // slot 0 is the row above the chunk, slots 1..n the chunk, slot n + 1 the row below
+    std::vector<sf::Uint8> buffer((chunk_rows + 2) * row_bytes);
+    std::vector<sf::Uint8> carry(2 * row_bytes);
+    std::vector<sf::Uint8> rgb(ppm ? chunk_rows * width * 3 : 0);
+
+    auto compute_rows = [&](int first_y, int last_y, int first_slot) {
+        #pragma omp parallel for schedule(dynamic) num_threads(threads)
+        for (int y = first_y; y < last_y; ++y) {
+            if (y < 0 || y >= static_cast<int>(height)) continue;
+            calculate_row(y, 0, width, width, height, &buffer[(first_slot + y - first_y) * row_bytes],
+                          c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
+        }
+    };
+
+    for (int chunk = 0; chunk < n_chunks; ++chunk) {
+        int chunk_start = my_start_y + chunk * chunk_rows;
+        int n = std::max(0, std::min(chunk_rows, my_rows - chunk * chunk_rows));
+        int chunk_end = chunk_start + n;
+        const void* write_ptr = nullptr;
+
+        if (n > 0) {
+            if (chunk == 0) {
+                compute_rows(chunk_start - 1, chunk_end + 1, 0);
+            } else {
+                std::memcpy(buffer.data(), carry.data(), carry.size());
+                compute_rows(chunk_start + 1, chunk_end + 1, 2);
+            }
+            std::memcpy(carry.data(), &buffer[n * row_bytes], carry.size());
+
+            int blur_start = (chunk_start == 0) ? 2 : 1;
+            int blur_end = (chunk_end == static_cast<int>(height)) ? n : n + 1;
+            if (Blur && blur_end > blur_start) {
+                apply_blur(buffer, width, blur_start, blur_end);
+            }
+
+            write_ptr = &buffer[row_bytes];
+            if (ppm) {
+                for (size_t i = 0, o = 0; i < n * row_bytes; i += 4, o += 3) {
+                    rgb[o]     = buffer[row_bytes + i];
+                    rgb[o + 1] = buffer[row_bytes + i + 1];
+                    rgb[o + 2] = buffer[row_bytes + i + 2];
+                }
+                write_ptr = rgb.data();
+            }
+        }
+
+        MPI_Offset offset = static_cast<MPI_Offset>(header.size()) + static_cast<MPI_Offset>(chunk_start) * width * channels;
+        MPI_File_write_at_all(fh, offset, write_ptr, n * width * channels, MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+
+    MPI_File_close(&fh);
+
+    long double end_time = omp_get_wtime();
+    long double elapsed_time = end_time - start_time;
+    if (rank == 0) {
+        std::cout<<"Rendering to "<< path <<" took "<< elapsed_time <<" seconds\n";
+    }
+    return elapsed_time;
+}
+
+// 2D block decomposition over an MPI_Cart_create grid. Every block keeps a one pixel frame around it for
+// the blur stencil, filled from the four neighbours (rows as contiguous runs, columns as a vector type).
+void ParallelCalculator::calculate_distributed_cart(int rank, int n_ranks, sf::Image& image,
+    unsigned int width, unsigned int height, const int dims[2],
+    const std::complex<double>& c_constant,
+    int max_iterations, int poly_degree,
+    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
+
+    int grid[2] = {dims[0], dims[1]};
+    int periods[2] = {0, 0};
+    MPI_Comm cart;
+    MPI_Cart_create(MPI_COMM_WORLD, 2, grid, periods, 0, &cart);
+
+    auto split = [](int total, int parts, int index) {
+        return index * (total / parts) + std::min(index, total % parts);
+    };
+    auto block_of = [&](int r, int block[4]) { // {y0, y1, x0, x1}
+        int coords[2];
+        MPI_Cart_coords(cart, r, 2, coords);
+        block[0] = split(height, grid[0], coords[0]);
+        block[1] = split(height, grid[0], coords[0] + 1);
+        block[2] = split(width, grid[1], coords[1]);
+        block[3] = split(width, grid[1], coords[1] + 1);
+    };
+
+    int block[4];
+    block_of(rank, block);
+    int y0 = block[0], y1 = block[1], x0 = block[2], x1 = block[3];
+    int bh = y1 - y0;
+    int bw = x1 - x0;
+    int stride = bw + 2;
+
+    std::vector<sf::Uint8> local_buffer((bh + 2) * stride * 4);
+    auto at = [&](int row, int col) { return &local_buffer[(static_cast<size_t>(row) * stride + col) * 4]; };
+
+    for (int y = y0; y < y1; ++y) {
+        calculate_row(y, x0, x1, width, height, at(y - y0 + 1, 1),
+                      c_constant, max_iterations, poly_degree, view_x_min, view_x_max, view_y_min, view_y_max);
+    }
+
+    int up, down, left, right;
+    MPI_Cart_shift(cart, 0, 1, &up, &down);
+    MPI_Cart_shift(cart, 1, 1, &left, &right);
+
+    MPI_Datatype row_type, column_type;
+    MPI_Type_contiguous(bw * 4, MPI_UNSIGNED_CHAR, &row_type);
+    MPI_Type_vector(bh, 4, stride * 4, MPI_UNSIGNED_CHAR, &column_type);
+    MPI_Type_commit(&row_type);
+    MPI_Type_commit(&column_type);
+
+    // neighbours outside the grid are MPI_PROC_NULL, which turns these into no-ops on the image border
+    MPI_Request requests[8];
+    MPI_Irecv(at(0, 1),      1, row_type,    up,    0, cart, &requests[0]);
+    MPI_Isend(at(1, 1),      1, row_type,    up,    1, cart, &requests[1]);
+    MPI_Irecv(at(bh + 1, 1), 1, row_type,    down,  1, cart, &requests[2]);
+    MPI_Isend(at(bh, 1),     1, row_type,    down,  0, cart, &requests[3]);
+    MPI_Irecv(at(1, 0),      1, column_type, left,  2, cart, &requests[4]);
+    MPI_Isend(at(1, 1),      1, column_type, left,  3, cart, &requests[5]);
+    MPI_Irecv(at(1, bw + 1), 1, column_type, right, 3, cart, &requests[6]);
+    MPI_Isend(at(1, bw),     1, column_type, right, 2, cart, &requests[7]);
+    MPI_Waitall(8, requests, MPI_STATUSES_IGNORE);
+
+    MPI_Type_free(&row_type);
+    MPI_Type_free(&column_type);
+
+    int row_start = (y0 == 0) ? 2 : 1;
+    int row_end = (y1 == static_cast<int>(height)) ? bh : bh + 1;
+    int col_start = (x0 == 0) ? 2 : 1;
+    int col_end = (x1 == static_cast<int>(width)) ? bw : bw + 1;
+    if (Blur && row_end > row_start && col_end > col_start) {
+        apply_blur(local_buffer, stride, row_start, row_end, col_start, col_end);
+    }
+
+    // send the interior of the padded block; rank 0 receives every block straight into place
+    int local_sizes[2] = {bh + 2, stride * 4};
+    int local_sub[2] = {bh, bw * 4};
+    int local_starts[2] = {1, 4};
+    MPI_Datatype interior_type;
+    MPI_Type_create_subarray(2, local_sizes, local_sub, local_starts, MPI_ORDER_C, MPI_UNSIGNED_CHAR, &interior_type);
+    MPI_Type_commit(&interior_type);
+
+    if (rank == 0) {
+        std::vector<sf::Uint8> final_pixels(static_cast<size_t>(width) * height * 4);
+        std::vector<MPI_Request> recvs(n_ranks);
+        std::vector<MPI_Datatype> placements(n_ranks);
+        int frame_sizes[2] = {static_cast<int>(height), static_cast<int>(width) * 4};
+        for (int r = 0; r < n_ranks; ++r) {
+            int b[4];
+            block_of(r, b);
+            int sub[2] = {b[1] - b[0], (b[3] - b[2]) * 4};
+            int starts[2] = {b[0], b[2] * 4};
+            MPI_Type_create_subarray(2, frame_sizes, sub, starts, MPI_ORDER_C, MPI_UNSIGNED_CHAR, &placements[r]);
+            MPI_Type_commit(&placements[r]);
+            MPI_Irecv(final_pixels.data(), 1, placements[r], r, 4, cart, &recvs[r]);
+        }
+        MPI_Send(local_buffer.data(), 1, interior_type, 0, 4, cart);
+        MPI_Waitall(n_ranks, recvs.data(), MPI_STATUSES_IGNORE);
+        for (int r = 0; r < n_ranks; ++r) {
+            MPI_Type_free(&placements[r]);
+        }
+        image.create(width, height, final_pixels.data());
+    } else {
+        MPI_Send(local_buffer.data(), 1, interior_type, 0, 4, cart);
+    }
+
+    MPI_Type_free(&interior_type);
+    MPI_Comm_free(&cart);
+}
+
+// Whole frames are the unit of work here. Every rank, rank 0 included, claims the next group of frames
+// with an atomic MPI_Fetch_and_op on a counter that lives on rank 0, so faster ranks simply claim more.
+// Frames go straight to disk from the rank that rendered them; nothing is gathered.
+int ParallelCalculator::render_frames(int rank, const std::vector<std::complex<double>>& c_values,
+    unsigned int width, unsigned int height,
+    const std::string& output_dir, const std::string& extension, int frames_per_claim,
+    int max_iterations, int poly_degree,
+    double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
+
+    long next_frame = 0;
+    MPI_Win counter;
+    MPI_Win_create(&next_frame, (rank == 0) ? sizeof(long) : 0, sizeof(long), MPI_INFO_NULL, MPI_COMM_WORLD, &counter);
+    MPI_Win_lock_all(0, counter);
+
+    long total = static_cast<long>(c_values.size());
+    long claim = std::max(1, frames_per_claim);
+    int rendered = 0;
+    sf::Image image;
+    image.create(width, height);
+
+    while (true) {
+        long first = 0;
+        MPI_Fetch_and_op(&claim, &first, MPI_LONG, 0, 0, MPI_SUM, counter);
+        MPI_Win_flush(0, counter);
+        if (first >= total) break;
+
+        long last = std::min(total, first + claim);
+        for (long frame = first; frame < last; ++frame) {
+            calculate_polynomial(image, c_values[frame], max_iterations, poly_degree,
+                                 view_x_min, view_x_max, view_y_min, view_y_max);
+
+            std::ostringstream path;
+            path << output_dir << "/frame_" << std::setw(5) << std::setfill('0') << frame << "." << extension;
+            if (!image.saveToFile(path.str())) {
+                std::cerr << "Error: Could not write " << path.str() << std::endl;
+            }
+            ++rendered;
+        }
+    }
+
+    MPI_Win_unlock_all(counter);
+    MPI_Win_free(&counter);
+    return rendered;
+}
@@ -0,0 +1,79 @@
+#include "../headers/RenderExecutor.hpp"
+#include <iostream>
+
+RenderExecutor::RenderExecutor(int workers, size_t max_queue) : maxQueue(max_queue), stopping(false), busy(0) {
+    if (workers < 1) {
+        std::cerr << "Warning: render executor needs at least one worker, using 1." << std::endl;
+        workers = 1;
+    }
+    if (maxQueue < 1) {
+        std::cerr << "Warning: render queue depth must be positive, using 1." << std::endl;
+        maxQueue = 1;
+    }
+    threads.reserve(workers);
+    for (int i = 0; i < workers; ++i) {
+        threads.emplace_back(&RenderExecutor::worker_loop, this);
+    }
+}
+
+RenderExecutor::~RenderExecutor() {
+    shutdown();
+}
+
+bool RenderExecutor::submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping || jobs.size() >= maxQueue) {
+            return false;
+        }
+        jobs.push_back(std::move(job));
+    }
+    ready.notify_one();
+    return true;
+}
+
+void RenderExecutor::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping && threads.empty()) {
+            return;
+        }
+        stopping = true;
+    }
+    ready.notify_all();
+    for (std::thread& t : threads) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+    threads.clear();
+}
+
+size_t RenderExecutor::queued() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.size();
+}
+
+bool RenderExecutor::idle() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.empty() && busy < threads.size();
+}
+
+void RenderExecutor::worker_loop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ready.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (jobs.empty()) {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+            ++busy;
+        }
+        job();
+        std::lock_guard<std::mutex> lock(mutex);
+        --busy;
+    }
+}
@@ -0,0 +1,74 @@
+#include "../headers/ResultCache.hpp"
+#include <cmath>
+#include <cstring>
+
+ResultCache::ResultCache(size_t capacity_bytes)
+    : capacity(capacity_bytes), bytes(0), hits(0), misses(0), evictions(0) {}
+
+std::shared_ptr<const ResultCache::Frame> ResultCache::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end()) {
+        ++misses;
+        return nullptr;
+    }
+    lru.splice(lru.begin(), lru, it->second);
+    ++hits;
+    return it->second->second;
+}
+
+void ResultCache::put(const std::string& key, std::shared_ptr<const Frame> frame) {
+    size_t size = cost(key, *frame);
+    if (size > capacity) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        bytes -= cost(key, *it->second->second);
+        lru.erase(it->second);
+        index.erase(it);
+    }
+    evict_to(capacity - size);
+    lru.emplace_front(key, std::move(frame));
+    index.emplace(key, lru.begin());
+    bytes += size;
+}
+
+ResultCache::Stats ResultCache::stats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return {hits, misses, evictions, index.size(), bytes, capacity};
+}
+
+void ResultCache::appendKey(std::string& key, double value) {
+    if (value == 0.0) {
+        value = 0.0; // -0 and +0 render the same frame
+    } else if (std::isfinite(value)) {
+        int exponent;
+        double mantissa = std::frexp(value, &exponent);
+        value = std::ldexp(std::round(std::ldexp(mantissa, 40)), exponent - 40);
+    }
+    char raw[sizeof(double)];
+    std::memcpy(raw, &value, sizeof(double));
+    key.append(raw, sizeof(double));
+}
+
+void ResultCache::appendKey(std::string& key, int64_t value) {
+    char raw[sizeof(int64_t)];
+    std::memcpy(raw, &value, sizeof(int64_t));
+    key.append(raw, sizeof(int64_t));
+}
+
+// what an entry holds on to: both strings plus a rough allowance for the list and map nodes
+size_t ResultCache::cost(const std::string& key, const Frame& frame) {
+    return frame.pixels.size() + 2 * key.size() + sizeof(Frame) + 128;
+}
+
+void ResultCache::evict_to(size_t budget) {
+    while (bytes > budget && !lru.empty()) {
+        bytes -= cost(lru.back().first, *lru.back().second);
+        index.erase(lru.back().first);
+        lru.pop_back();
+        ++evictions;
+    }
+}
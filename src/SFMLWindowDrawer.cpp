@@ -1,4 +1,5 @@
 #include "../headers/SFMLWindowDrawer.hpp"
+#include "../headers/FrameCodec.hpp"
 #include <typeinfo>
 #include <iostream>
 #include <sstream>
@@ -8,6 +9,9 @@
 #include <chrono>
 #include <iomanip>
 #include <mpi.h>
+#include <vector>
+#include <cstring>
+#include <algorithm>
 
 int maxThreads = std::thread::hardware_concurrency();
 
@@ -35,7 +39,8 @@ SFMLWindowDrawer::SFMLWindowDrawer(unsigned int width, unsigned int height, cons
       drift_velocity(0.0, 0.0),
       velocity_step(0.005),
       needsRecalculation(true),
-      simulateTimeout(false)
+      simulateTimeout(false),
+      frameWidth(0), frameHeight(0), frameMaxIterations(0)
 {
     int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
@@ -68,6 +73,7 @@ SFMLWindowDrawer::SFMLWindowDrawer(unsigned int width, unsigned int height, cons
 
 SFMLWindowDrawer::~SFMLWindowDrawer()
 {
+    closeSession();
     delete sequentialCalc;
     delete parallelCalc;
 }
@@ -164,22 +170,22 @@ void SFMLWindowDrawer::processEvents()
             case sf::Keyboard::Num1:
             case sf::Keyboard::Numpad1:
                 calculator->setTheme(1);
-                needsRecalculation = true;
+                colorizeFrame();
                 break;
             case sf::Keyboard::Num2:
             case sf::Keyboard::Numpad2:
                 calculator->setTheme(2);
-                needsRecalculation = true;
+                colorizeFrame();
                 break;
             case sf::Keyboard::Num3:
             case sf::Keyboard::Numpad3:
                 calculator->setTheme(3);
-                needsRecalculation = true;
+                colorizeFrame();
                 break;
             case sf::Keyboard::Num4:
             case sf::Keyboard::Numpad4:
                 calculator->setTheme(4);
-                needsRecalculation = true;
+                colorizeFrame();
                 break;
 
             // Polynomial control
@@ -338,10 +344,24 @@ void SFMLWindowDrawer::update()
             needsRecalculation = false;
         }
     }
+    presentSessionFrame();
     // We update the UI text *every* frame
     updateUI();
 }
 
+void SFMLWindowDrawer::colorizeFrame()
+{
+    if (frameCounts.empty())
+    {
+        needsRecalculation = true;
+        return;
+    }
+    std::vector<sf::Uint8> rgba(frameCounts.size() * 4);
+    calculator->post_process(frameCounts.data(), frameWidth, frameHeight, frameMaxIterations, rgba.data(), omp_get_max_threads());
+    fractalImage.create(frameWidth, frameHeight, rgba.data());
+    fractalTexture.update(fractalImage);
+}
+
 void SFMLWindowDrawer::updateUI()
 {
     // This uses string streams to build the text
@@ -425,6 +445,21 @@ void SFMLWindowDrawer::recalculateFractal()
     request.set_x_max(view_x_max);
     request.set_y_min(view_y_min);
     request.set_y_max(view_y_max);
+    // counts instead of colours: the palette and blur are applied here, so themes switch without the server
+    request.set_format(current_max_iterations <= 255 ? fractal::PALETTE8 : fractal::ITER16);
+    request.set_encoding(fractal::DEFLATE);
+    request.set_shared_memory(sharedMemory);
+
+    // normally the state just goes down the open session and the frame shows up in update(); the
+    // simulated disruption is per call, so it keeps using single requests
+    if (!simulateTimeout)
+    {
+        // a coarse preview shows up within milliseconds, the full frame replaces it when done
+        request.set_progressive(true);
+        if (sendSessionUpdate(request))
+            return;
+        request.set_progressive(false);
+    }
 
     fractal::JuliaResponse response;
     grpc::ClientContext context;
@@ -441,28 +476,208 @@ void SFMLWindowDrawer::recalculateFractal()
     auto end = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double, std::milli> latency = end - start;
 
+    logMetrics(status.ok(), latency.count());
+
+    if (status.ok())
+    {
+        showFrame(response, request.width(), request.height(), request.max_iterations(), latency.count());
+    }
+    else
+    {
+        std::cerr << "[ERROR] gRPC failed: " << status.error_message() 
+                  << " (Latency: " << latency.count() << "ms)" << std::endl;
+    }
+}
+
+void SFMLWindowDrawer::logMetrics(bool ok, double latency_ms)
+{
     std::ofstream logFile("data/metrics_log.csv", std::ios::app);
     if (logFile.is_open()) 
     {
         auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
         logFile << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S") << ","
-                << (status.ok() ? "SUCCESS" : "FAILURE") << ","
-                << latency.count() << ","
+                << (ok ? "SUCCESS" : "FAILURE") << ","
+                << latency_ms << ","
                 << (simulateTimeout ? "DISRUPTED" : "NORMAL") << "\n";
         logFile.close();
     }
+}
 
-    if (status.ok())
+void SFMLWindowDrawer::showFrame(const fractal::JuliaResponse &response, unsigned int width, unsigned int height,
+                                 int max_iterations, double latency_ms)
+{
+    const char *data = response.rgba_data().data();
+    size_t size = response.rgba_data().size();
+    if (response.has_shared())
     {
-        const std::string &pixelData = response.rgba_data();
-        fractalImage.create(request.width(), request.height(),
-                            reinterpret_cast<const sf::Uint8 *>(pixelData.data()));
+        // read in place; it only counts if the server has not lapped the ring over it by the time it is decoded
+        const fractal::SharedFrame &shared = response.shared();
+        if (!sharedRing || sharedRing->getName() != shared.name() || sharedRing->getInstance() != shared.instance())
+            sharedRing.reset(new SharedFrameRing(shared.name()));
+        data = sharedRing->at(shared.position(), shared.size());
+        size = shared.size();
+        if (!data)
+        {
+            std::cerr << "[ERROR] Shared frame " << shared.name() << "@" << shared.position() << " is gone";
+            if (!sharedRing->enabled())
+            {
+                // not on the server's host after all
+                std::cerr << ", asking for frames over the wire from now on";
+                sharedMemory = false;
+            }
+            std::cerr << std::endl;
+            return;
+        }
+    }
+    unsigned int bytes_per_pixel = response.format() == fractal::PALETTE8 ? 1 : response.format() == fractal::ITER16 ? 2 : 4;
+    // a progressive preview is 1/scale of the size and is blown up to the window below
+    unsigned int scale = response.scale() > 1 ? static_cast<unsigned int>(response.scale()) : 1;
+    unsigned int sent_width = (width + scale - 1) / scale, sent_height = (height + scale - 1) / scale;
+    std::vector<sf::Uint8> pixels(static_cast<size_t>(sent_width) * sent_height * bytes_per_pixel);
+    if (!FrameCodec::decode(data, size, sent_width, sent_height, bytes_per_pixel,
+                            static_cast<FrameCodec::Encoding>(response.encoding()), pixels.data()))
+    {
+        std::cerr << "[ERROR] Could not decode frame (encoding " << response.encoding() << ", "
+                  << size << " bytes)" << std::endl;
+        return;
+    }
+    if (response.has_shared() && !sharedRing->intact(response.shared().position()))
+    {
+        std::cerr << "[ERROR] Shared frame was overwritten while it was read" << std::endl;
+        return;
+    }
+    if (scale > 1)
+    {
+        std::vector<sf::Uint8> full(static_cast<size_t>(width) * height * bytes_per_pixel);
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            const sf::Uint8 *src = pixels.data() + static_cast<size_t>(y / scale) * sent_width * bytes_per_pixel;
+            sf::Uint8 *dst = full.data() + static_cast<size_t>(y) * width * bytes_per_pixel;
+            for (unsigned int x = 0; x < width; ++x)
+                std::memcpy(dst + x * bytes_per_pixel, src + (x / scale) * bytes_per_pixel, bytes_per_pixel);
+        }
+        pixels.swap(full);
+    }
+
+    if (response.format() == fractal::RGBA8)
+    {
+        frameCounts.clear();
+        fractalImage.create(width, height, pixels.data());
         fractalTexture.update(fractalImage);
-        std::cout << "[SUCCESS] Latency: " << latency.count() << " ms" << std::endl;
     }
     else
     {
-        std::cerr << "[ERROR] gRPC failed: " << status.error_message() 
-                  << " (Latency: " << latency.count() << "ms)" << std::endl;
+        frameCounts.resize(static_cast<size_t>(width) * height);
+        if (bytes_per_pixel == 1)
+            std::copy(pixels.begin(), pixels.end(), frameCounts.begin());
+        else
+            std::memcpy(frameCounts.data(), pixels.data(), pixels.size());
+        frameWidth = width;
+        frameHeight = height;
+        frameMaxIterations = max_iterations;
+        colorizeFrame();
+    }
+    if (scale > 1)
+        std::cout << "[PREVIEW 1/" << scale << "] Latency: " << latency_ms << " ms (" << size << " bytes" << (response.has_shared() ? " shared" : "") << ")" << std::endl;
+    else
+        std::cout << "[SUCCESS] Latency: " << latency_ms << " ms (" << size << " bytes" << (response.has_shared() ? " shared" : "") << ")" << std::endl;
+}
+
+// Pushes the state down the InteractiveSession stream, opening it first if needed. The server drops
+// states that are superseded before it gets to them, so sending every change costs nothing.
+bool SFMLWindowDrawer::sendSessionUpdate(const fractal::JuliaRequest &request)
+{
+    if (!session)
+    {
+        sessionContext.reset(new grpc::ClientContext());
+        session = stub_->InteractiveSession(sessionContext.get());
+        sessionBroken = false;
+        sessionReader = std::thread([this]
+                                    { readSession(); });
+    }
+
+    fractal::SessionUpdate update;
+    update.set_sequence(++sessionSequence);
+    *update.mutable_frame() = request;
+    if (!session->Write(update))
+    {
+        closeSession();
+        return false;
+    }
+    sessionSent.push_back({sessionSequence, static_cast<unsigned int>(request.width()),
+                           static_cast<unsigned int>(request.height()), request.max_iterations(),
+                           std::chrono::steady_clock::now()});
+    // frames only ever come back for the newest states, so the oldest entries can go
+    if (sessionSent.size() > 64)
+        sessionSent.pop_front();
+    return true;
+}
+
+// reader thread: keeps only the newest frame for update() to pick up
+void SFMLWindowDrawer::readSession()
+{
+    fractal::SessionFrame frame;
+    while (session->Read(&frame))
+    {
+        std::lock_guard<std::mutex> lock(sessionMutex);
+        sessionFrame.Swap(&frame);
+        sessionFrameReady = true;
     }
+    std::lock_guard<std::mutex> lock(sessionMutex);
+    sessionBroken = true;
+}
+
+// shows the frame the reader thread last received, and replaces a session that has ended
+void SFMLWindowDrawer::presentSessionFrame()
+{
+    fractal::SessionFrame frame;
+    bool broken;
+    {
+        std::lock_guard<std::mutex> lock(sessionMutex);
+        broken = sessionBroken;
+        if (sessionFrameReady)
+        {
+            frame.Swap(&sessionFrame);
+            sessionFrameReady = false;
+        }
+    }
+
+    if (frame.sequence() != 0)
+    {
+        while (!sessionSent.empty() && sessionSent.front().sequence < frame.sequence())
+            sessionSent.pop_front();
+        if (!sessionSent.empty() && sessionSent.front().sequence == frame.sequence())
+        {
+            const SentUpdate &sent = sessionSent.front();
+            std::chrono::duration<double, std::milli> latency = std::chrono::steady_clock::now() - sent.sent;
+            if (frame.response().scale() <= 1)
+                logMetrics(true, latency.count());
+            showFrame(frame.response(), sent.width, sent.height, sent.max_iterations, latency.count());
+        }
+    }
+
+    if (session && broken)
+    {
+        logMetrics(false, 0.0);
+        closeSession();
+        // the last state may never have been drawn, so send it again on a new session
+        needsRecalculation = true;
+    }
+}
+
+void SFMLWindowDrawer::closeSession()
+{
+    if (!session)
+        return;
+    sessionContext->TryCancel();
+    if (sessionReader.joinable())
+        sessionReader.join();
+    grpc::Status status = session->Finish();
+    if (!status.ok() && status.error_code() != grpc::StatusCode::CANCELLED)
+        std::cerr << "[ERROR] Session ended: " << status.error_message() << std::endl;
+    session.reset();
+    sessionContext.reset();
+    sessionSent.clear();
+    sessionFrameReady = false;
+    sessionBroken = false;
 }
@@ -2,22 +2,28 @@
 #include <cmath>
 #include <stdlib.h>
 #include <omp.h>
+#include <vector>
 #include<iostream>
 
 
 
-// this function doesnt return anything, it simply sets the pixel color based on the number of iterations
+// fills the image with the escape counts mapped through the theme palette (and blurred when Blur is on)
 double SequentialCalculator::calculate_polynomial(sf::Image& image, const std::complex<double>& c_constant, 
     int max_iterations, int poly_degree,
     double view_x_min, double view_x_max, double view_y_min, double view_y_max) {
         // unsigned because they have more range for image dimensions since removing the sign bit allows for an extra bit of magnitude :D 
     unsigned int width = image.getSize().x;
     unsigned int height = image.getSize().y;
+    if (max_iterations > 65535) {
+        std::cerr << "Warning: max_iterations capped at 65535." << std::endl;
+        max_iterations = 65535;
+    }
         // Iterate over each pixel in the image
     long double start_time = omp_get_wtime();
 
-    for (unsigned int px = 0; px < width; ++px) {
-        for (unsigned int py = 0; py < height; ++py) {
+    std::vector<sf::Uint16> iterations(static_cast<size_t>(width) * height);
+    for (unsigned int py = 0; py < height; ++py) {
+        for (unsigned int px = 0; px < width; ++px) {
             double x0 = map(px, 0, width, view_x_min, view_x_max);
             double y0 = map(py, 0, height, view_y_min, view_y_max);
             std::complex<double> z(x0, y0);
@@ -31,11 +37,14 @@ double SequentialCalculator::calculate_polynomial(sf::Image& image, const std::c
                 z = z_next;
                 iteration++;
             }
-            sf::Color color = PixelArtist(iteration, max_iterations);
-            image.setPixel(px, py, color);
+            iterations[static_cast<size_t>(py) * width + px] = static_cast<sf::Uint16>(iteration);
         }
     }
 
+    std::vector<sf::Uint8> pixels(iterations.size() * 4);
+    post_process(iterations.data(), width, height, max_iterations, pixels.data(), 1);
+    image.create(width, height, pixels.data());
+
     long double end_time = omp_get_wtime();
     double elapsed_time = end_time - start_time;
     std::cout<<"Calculation took "<< elapsed_time <<" seconds\n";
@@ -0,0 +1,139 @@
+#include "../headers/SharedFrameRing.hpp"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+const uint64_t RING_MAGIC = 0x314d485341494c55; // "ULIASHM1"
+const size_t HEADER_BYTES = 64;
+}
+
+struct SharedFrameRing::Header {
+    uint64_t magic;
+    uint64_t capacity;
+    uint64_t instance;
+    std::atomic<uint64_t> reserved;
+};
+static_assert(sizeof(std::atomic<uint64_t>) == 8 && std::atomic<uint64_t>::is_always_lock_free,
+              "the ring header is shared with other processes");
+
+SharedFrameRing::SharedFrameRing(const std::string& name_, size_t capacity_bytes)
+    : name(name_), owner(true), map(nullptr), capacity(capacity_bytes), mapped(HEADER_BYTES + capacity_bytes), head(0) {
+    // a server that died without cleaning up leaves its object behind; clients still holding it keep it alive
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        std::cerr << "Warning: cannot create shared frame ring " << name << ": " << std::strerror(errno) << std::endl;
+        return;
+    }
+    // reserve the pages now: a sparse object larger than what is left of /dev/shm would only fail with
+    // SIGBUS in the first put() that touches a page past it
+    int reserved = posix_fallocate(fd, 0, static_cast<off_t>(mapped));
+    if (reserved != 0) {
+        std::cerr << "Warning: cannot reserve " << (mapped >> 20) << " MB for shared frame ring " << name << ": "
+                  << std::strerror(reserved) << ", shared frames disabled." << std::endl;
+        close(fd);
+        shm_unlink(name.c_str());
+        return;
+    }
+    void* region = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) {
+        std::cerr << "Warning: cannot map shared frame ring " << name << ": " << std::strerror(errno) << std::endl;
+        shm_unlink(name.c_str());
+        return;
+    }
+    map = static_cast<char*>(region);
+    Header* h = new (map) Header();
+    h->capacity = capacity;
+    h->instance = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count()) ^
+                  (static_cast<uint64_t>(getpid()) << 48);
+    h->reserved.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    h->magic = RING_MAGIC;
+}
+
+SharedFrameRing::SharedFrameRing(const std::string& name_)
+    : name(name_), owner(false), map(nullptr), capacity(0), mapped(0), head(0) {
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        std::cerr << "Warning: cannot open shared frame ring " << name << ": " << std::strerror(errno) << std::endl;
+        return;
+    }
+    struct stat st;
+    void* region = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) > HEADER_BYTES) {
+        region = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (region == MAP_FAILED) {
+        std::cerr << "Warning: cannot map shared frame ring " << name << std::endl;
+        return;
+    }
+    const Header* h = static_cast<const Header*>(region);
+    if (h->magic != RING_MAGIC || h->capacity != static_cast<uint64_t>(st.st_size) - HEADER_BYTES) {
+        std::cerr << "Warning: " << name << " is not a shared frame ring" << std::endl;
+        munmap(region, static_cast<size_t>(st.st_size));
+        return;
+    }
+    map = static_cast<char*>(region);
+    mapped = static_cast<size_t>(st.st_size);
+    capacity = mapped - HEADER_BYTES;
+}
+
+SharedFrameRing::~SharedFrameRing() {
+    if (map) {
+        munmap(map, mapped);
+        if (owner) {
+            shm_unlink(name.c_str());
+        }
+    }
+}
+
+SharedFrameRing::Header* SharedFrameRing::header() const {
+    return reinterpret_cast<Header*>(map);
+}
+
+uint64_t SharedFrameRing::getInstance() const {
+    return map ? header()->instance : 0;
+}
+
+bool SharedFrameRing::put(const char* data, size_t size, uint64_t& position) {
+    if (!map || !owner || size > capacity) {
+        return false;
+    }
+    // the copy stays under the lock: two frames in flight could otherwise overlap once the ring laps
+    std::lock_guard<std::mutex> lock(mutex);
+    position = head;
+    if (position % capacity + size > capacity) {
+        position += capacity - position % capacity;
+    }
+    head = position + size;
+    header()->reserved.store(head, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(map + HEADER_BYTES + position % capacity, data, size);
+    return true;
+}
+
+const char* SharedFrameRing::at(uint64_t position, size_t size) const {
+    if (!map || size > capacity || position % capacity + size > capacity || !intact(position)) {
+        return nullptr;
+    }
+    return map + HEADER_BYTES + position % capacity;
+}
+
+bool SharedFrameRing::intact(uint64_t position) const {
+    if (!map) {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t reserved = header()->reserved.load(std::memory_order_relaxed);
+    return reserved >= position && reserved - position <= capacity;
+}
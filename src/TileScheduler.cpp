@@ -0,0 +1,95 @@
+#include "../headers/TileScheduler.hpp"
+#include <iostream>
+#include <pthread.h>
+#include <sched.h>
+
+TileScheduler::TileScheduler(int workers, bool pin_threads) : stopping(false), pinned(false), cursor(0) {
+    if (workers < 1) {
+        std::cerr << "Warning: tile scheduler needs at least one worker, using 1." << std::endl;
+        workers = 1;
+    }
+    threads.reserve(workers);
+    for (int i = 0; i < workers; ++i) {
+        threads.emplace_back(&TileScheduler::worker_loop, this);
+    }
+
+    if (pin_threads) {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        std::vector<int> cpus;
+        if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &mask)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        if (cpus.size() < threads.size()) {
+            std::cerr << "Warning: " << threads.size() << " compute threads but only " << cpus.size()
+                      << " CPUs, not pinning them." << std::endl;
+            return;
+        }
+        pinned = true;
+        for (size_t i = 0; i < threads.size(); ++i) {
+            cpu_set_t one;
+            CPU_ZERO(&one);
+            CPU_SET(cpus[i], &one);
+            if (pthread_setaffinity_np(threads[i].native_handle(), sizeof(one), &one) != 0) {
+                std::cerr << "Warning: cannot pin compute thread " << i << " to CPU " << cpus[i] << "." << std::endl;
+                pinned = false;
+            }
+        }
+    }
+}
+
+TileScheduler::~TileScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work.notify_all();
+    for (std::thread& t : threads) {
+        t.join();
+    }
+}
+
+void TileScheduler::run(int n_tiles, const std::function<void(int)>& task) {
+    if (n_tiles <= 0) {
+        return;
+    }
+    Job job{&task, n_tiles, 0, 0};
+    std::unique_lock<std::mutex> lock(mutex);
+    active.push_back(&job);
+    work.notify_all();
+    finished.wait(lock, [&job] { return job.done == job.total; });
+}
+
+void TileScheduler::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        work.wait(lock, [this] { return stopping || !active.empty(); });
+        if (active.empty()) {
+            return;
+        }
+
+        // one tile from the job under the cursor, then move on to the next job
+        if (cursor >= active.size()) {
+            cursor = 0;
+        }
+        Job* job = active[cursor];
+        int tile = job->next++;
+        if (job->next == job->total) {
+            active.erase(active.begin() + cursor);
+        } else {
+            ++cursor;
+        }
+
+        lock.unlock();
+        (*job->task)(tile);
+        lock.lock();
+
+        if (++job->done == job->total) {
+            finished.notify_all();
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include <grpcpp/grpcpp.h>
 #include "fractal.grpc.pb.h"
 #include <mpi.h>
+#include <cstdlib>
 
 
 int main(int argc, char **argv)
@@ -11,8 +12,15 @@ int main(int argc, char **argv)
 
     std::string server_list = 
     "ipv4:127.0.0.1:50051,127.0.0.1:50052";
+    // e.g. unix:/tmp/fractal.sock for a server on this host started with FRACTAL_UNIX_SOCKET
+    const char *server_env = std::getenv("FRACTAL_SERVER");
+    if (server_env && *server_env)
+        server_list = server_env;
     std::string service_config = R"(
     {
+      "healthCheckConfig": {
+        "serviceName": "fractal.FractalService"
+      },
       "methodConfig": [{
         "name": [{
           "service": "fractal.FractalService"
@@ -24,6 +32,7 @@ int main(int argc, char **argv)
           "backoffMultiplier": 2,
           "retryableStatusCodes": [
             "UNAVAILABLE",
+            "RESOURCE_EXHAUSTED",
             "DEADLINE_EXCEEDED"
           ]
         }
@@ -44,6 +53,8 @@ int main(int argc, char **argv)
     auto stub = fractal::FractalService::NewStub(channel);
 
     SFMLWindowDrawer drawer(800, 600, "Julia Set Explorer (gRPC Replicas)", std::move(stub));
+    const char *shm = std::getenv("FRACTAL_SHM");
+    drawer.setSharedMemory(shm && std::string(shm) == "1");
 
     drawer.run();
 
@@ -0,0 +1,114 @@
+#include "../headers/ParallelCalculator.hpp"
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <filesystem>
+#include <mpi.h>
+
+// Same c walk as spark_app/generate_trajectory.py: a straight line that bounces off |c| = 2
+std::vector<std::complex<double>> build_trajectory(int frames, double c_real, double c_imag, double step_real, double step_imag)
+{
+    std::vector<std::complex<double>> c_values;
+    c_values.reserve(frames);
+    for (int i = 0; i < frames; ++i)
+    {
+        c_values.emplace_back(std::round(c_real * 1e6) / 1e6, std::round(c_imag * 1e6) / 1e6);
+        c_real += step_real;
+        c_imag += step_imag;
+        if (std::abs(c_real) > 2.0) step_real *= -1;
+        if (std::abs(c_imag) > 2.0) step_imag *= -1;
+    }
+    return c_values;
+}
+
+// Headless MPI renderer.
+// One frame of any size, written straight to disk with MPI-IO:
+//   mpirun -np 64 ./mpi_render --width 100000 --height 100000 --out julia.ppm
+// A whole c-trajectory, one frame per rank at a time:
+//   mpirun -np 16 ./mpi_render --frames 5000 --out-dir frames --width 800 --height 600
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+
+    int rank, n_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+
+    unsigned int width = 1920;
+    unsigned int height = 1080;
+    std::string out = "julia.ppm";
+    std::string format = "ppm";
+    double c_real = -0.8, c_imag = 0.156;
+    int max_iterations = 100;
+    int poly_degree = 2;
+    int theme = 1;
+    int threads = 0;
+    int frames = 0;
+    int group = 4;
+    std::string out_dir = "frames";
+    std::string image_format = "png";
+    double step_real = 0.0015, step_imag = 0.0008;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        std::string key = argv[i];
+        std::string value = argv[i + 1];
+        if (key == "--width") width = std::stoul(value);
+        else if (key == "--height") height = std::stoul(value);
+        else if (key == "--out") out = value;
+        else if (key == "--format") format = value;
+        else if (key == "--c-real") c_real = std::stod(value);
+        else if (key == "--c-imag") c_imag = std::stod(value);
+        else if (key == "--iterations") max_iterations = std::stoi(value);
+        else if (key == "--degree") poly_degree = std::stoi(value);
+        else if (key == "--theme") theme = std::stoi(value);
+        else if (key == "--threads") threads = std::stoi(value);
+        else if (key == "--frames") frames = std::stoi(value);
+        else if (key == "--group") group = std::stoi(value);
+        else if (key == "--out-dir") out_dir = value;
+        else if (key == "--image-format") image_format = value;
+        else if (key == "--step-real") step_real = std::stod(value);
+        else if (key == "--step-imag") step_imag = std::stod(value);
+        else if (rank == 0) std::cerr << "Warning: ignoring unknown option " << key << std::endl;
+    }
+
+    try
+    {
+        ParallelCalculator calculator;
+        calculator.setTheme(theme);
+        calculator.setNumThreads(threads);
+        if (frames > 0)
+        {
+            if (rank == 0)
+                std::filesystem::create_directories(out_dir);
+            MPI_Barrier(MPI_COMM_WORLD);
+
+            double start = MPI_Wtime();
+            std::vector<std::complex<double>> c_values = build_trajectory(frames, c_real, c_imag, step_real, step_imag);
+            int rendered = calculator.render_frames(rank, c_values, width, height, out_dir, image_format, group,
+                                                    max_iterations, poly_degree, -2.0, 2.0, -2.0, 2.0);
+            std::cout << "Rank " << rank << " rendered " << rendered << " frames" << std::endl;
+
+            MPI_Barrier(MPI_COMM_WORLD);
+            if (rank == 0)
+                std::cout << frames << " frames written to " << out_dir << " in " << MPI_Wtime() - start << " seconds" << std::endl;
+        }
+        else
+        {
+            calculator.render_to_file(rank, n_ranks, width, height, out, format,
+                                      std::complex<double>(c_real, c_imag), max_iterations, poly_degree,
+                                      -2.0, 2.0, -2.0, 2.0);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "An error occurred: " << e.what() << std::endl;
+        MPI_Abort(MPI_COMM_WORLD, -1);
+        return -1;
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -1,69 +1,273 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <cstdlib>
 #include <grpcpp/grpcpp.h>
 #include "fractal.grpc.pb.h"
 #include "headers/ParallelCalculator.hpp"
+#include "headers/RenderExecutor.hpp"
+#include "headers/TileScheduler.hpp"
+#include "headers/RequestBatcher.hpp"
+#include "headers/CpuBudget.hpp"
+#include "headers/FrameCodec.hpp"
+#include "headers/ResultCache.hpp"
+#include "headers/DiskCache.hpp"
+#include "headers/SharedFrameRing.hpp"
+#include "headers/BufferPool.hpp"
 #include <grpcpp/ext/proto_server_reflection_plugin.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/health_check_service_interface.h>
+#include <google/protobuf/arena.h>
 #include<thread>
 #include<unistd.h>
 #include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <future>
+#include <deque>
+#include <complex>
+#include <cstring>
+#include <functional>
 
 using fractal::JuliaRequest;
 using fractal::JuliaResponse;
 using grpc::Server;
 using grpc::ServerBuilder;
-using grpc::ServerContext;
+using grpc::CallbackServerContext;
+using grpc::ServerUnaryReactor;
 using grpc::Status;
 
 std::unique_ptr<grpc::Server> g_server;
 
-class FractalServiceImpl final : public fractal::FractalService::Service
+// integer setting from the environment, or fallback when it is unset or not a number
+static int env_int(const char *name, int fallback)
+{
+    const char *value = std::getenv(name);
+    if (!value || !*value)
+        return fallback;
+    char *end = nullptr;
+    long parsed = std::strtol(value, &end, 10);
+    if (*end != '\0')
+    {
+        std::cerr << "Warning: ignoring " << name << "=" << value << ", not an integer" << std::endl;
+        return fallback;
+    }
+    return static_cast<int>(parsed);
+}
+
+// CalculateJulia request and response live on one protobuf Arena per call, which starts in a block
+// inside the holder, so a call costs one allocation for its messages instead of one per field
+class ArenaMessageHolder : public grpc::MessageHolder<JuliaRequest, JuliaResponse>
+{
+    alignas(8) char initial_block_[1024];
+    google::protobuf::Arena arena_;
+
+    static google::protobuf::ArenaOptions options(char *block)
+    {
+        google::protobuf::ArenaOptions opts;
+        opts.initial_block = block;
+        opts.initial_block_size = sizeof(initial_block_);
+        return opts;
+    }
+
+public:
+    ArenaMessageHolder() : arena_(options(initial_block_))
+    {
+        set_request(google::protobuf::Arena::CreateMessage<JuliaRequest>(&arena_));
+        set_response(google::protobuf::Arena::CreateMessage<JuliaResponse>(&arena_));
+    }
+    void Release() override { delete this; }
+};
+
+class ArenaMessageAllocator : public grpc::MessageAllocator<JuliaRequest, JuliaResponse>
+{
+public:
+    grpc::MessageHolder<JuliaRequest, JuliaResponse> *AllocateMessages() override
+    {
+        return new ArenaMessageHolder();
+    }
+};
+
+// the largest frame a request may ask for (16384 x 16384), whose counts and RGBA pixels alone take 1.5 GB
+const uint64_t MAX_FRAME_PIXELS = uint64_t(1) << 28;
+
+// a frame waiting to be rendered: a CalculateJulia call or one entry of a CalculateJuliaBatch stream
+struct PendingRender
+{
+    CallbackServerContext *context = nullptr;
+    const JuliaRequest *request = nullptr;
+    JuliaResponse *response = nullptr;
+    std::function<void(const Status &)> done; // called once the response is filled in, or with the error
+    std::string key; // render parameters, see render_key()
+    // set once the call is cancelled (which includes its deadline passing), or by an InteractiveSession once
+    // a newer update makes this frame stale; the render then stops at its next row
+    std::shared_ptr<std::atomic<bool>> cancel = nullptr;
+    // counts that progressive previews already filled in on the grid of done_step, for the render to finish
+    std::shared_ptr<std::vector<sf::Uint16>> counts = nullptr;
+    unsigned int done_step = 0;
+    // iterations the render is estimated to take (ParallelCalculator::estimate_iterations), 0 until known
+    double cost = 0;
+};
+
+// A CalculateJulia call whose render stops early when the client cancels it or its deadline passes
+class UnaryCall : public grpc::ServerUnaryReactor
+{
+public:
+    std::shared_ptr<std::atomic<bool>> cancel = std::make_shared<std::atomic<bool>>(false);
+
+    void OnCancel() override { cancel->store(true); }
+    void OnDone() override { delete this; }
+};
+
+// Callback service: requests are parsed on gRPC's I/O threads and handed to a bounded render
+// executor, so a long render never holds a transport thread. A full queue is answered with
+// RESOURCE_EXHAUSTED straight away, which the clients retry on another replica.
+// Requests arriving within FRACTAL_BATCH_WINDOW_US of each other are rendered as one batch.
+// Finished frames are kept in an LRU cache of FRACTAL_CACHE_MB, so repeated requests skip all of it,
+// and a request identical to one still rendering waits for that render instead of starting its own.
+// With FRACTAL_DISK_CACHE set they are also appended to a memory-mapped file that outlives restarts.
+// A render stops at its next row once its call is cancelled or past its deadline, and a request whose
+// estimated render time already exceeds what is left of its deadline is turned away before it starts.
+// CalculateJuliaStream sends one frame as row bands, rendering each while the one before it is written.
+// CalculateJuliaBatch feeds all of its frames into the same pipeline and streams them back as they finish;
+// RenderTrajectory generates its frames itself and keeps a window of them rendering ahead of the stream.
+// InteractiveSession renders only the newest state a client has pushed and cancels renders it made stale.
+class FractalServiceImpl final : public fractal::FractalService::CallbackService
 {
     ParallelCalculator calculator;
     std::string server_id_;
+    RenderExecutor executor_;
+    std::unique_ptr<RequestBatcher<PendingRender>> batcher_;
+    ResultCache cache_;
+    std::unique_ptr<DiskCache> disk_;
+    std::unique_ptr<SharedFrameRing> ring_;
+    // key -> requests waiting on the render already in flight for that key (its leader)
+    std::unordered_map<std::string, std::vector<PendingRender>> inflight_;
+    std::mutex inflight_mutex_;
+    std::atomic<uint64_t> coalesced_{0};
+    ArenaMessageAllocator allocator_;
+    // scratch counts and colour buffers reused from batch to batch
+    BufferPool<sf::Uint16> count_pool_;
+    BufferPool<sf::Uint8> pixel_pool_;
+    size_t batch_max_;
+    size_t chunk_bytes_;
+    // render seconds per estimated iteration, learned from finished renders; 0 until the first one
+    std::atomic<double> seconds_per_iteration_{0.0};
 
     public:
-        FractalServiceImpl(const std::string& server_id) : server_id_(server_id) {}
-    bool timeout_state = false;
+        FractalServiceImpl(const std::string& server_id, TileScheduler *scheduler)
+            : server_id_(server_id),
+              executor_(env_int("FRACTAL_RENDER_WORKERS", 4), env_int("FRACTAL_QUEUE_DEPTH", 64)),
+              cache_(static_cast<size_t>(std::max(0, env_int("FRACTAL_CACHE_MB", 256))) << 20),
+              count_pool_(std::max(0, env_int("FRACTAL_POOL_BUFFERS", 16))),
+              pixel_pool_(std::max(0, env_int("FRACTAL_POOL_BUFFERS", 16))),
+              batch_max_(static_cast<size_t>(std::max(1, env_int("FRACTAL_BATCH_MAX", 16)))),
+              chunk_bytes_(static_cast<size_t>(std::max(1, env_int("FRACTAL_CHUNK_KB", 1024))) << 10)
+        {
+            SetMessageAllocatorFor_CalculateJulia(&allocator_);
+            // every render shares the one compute pool, however many are in flight
+            calculator.setScheduler(scheduler);
+            // FRACTAL_BLUR=0 turns off the post-process blur for every response
+            const char *blur = std::getenv("FRACTAL_BLUR");
+            if (blur && std::string(blur) == "0")
+                calculator.setBlur(false);
+            std::cout << "Render executor: " << executor_.getWorkers() << " worker(s), queue depth "
+                      << executor_.getMaxQueue() << std::endl;
+
+            int window_us = env_int("FRACTAL_BATCH_WINDOW_US", 2000);
+            if (window_us > 0)
+            {
+                batcher_.reset(new RequestBatcher<PendingRender>(
+                    std::chrono::microseconds(window_us), batch_max_,
+                    [this](std::vector<PendingRender> &&batch)
+                    { dispatch(std::move(batch)); },
+                    [this]
+                    { return executor_.idle(); }));
+                std::cout << "Batching window: " << window_us << " us" << std::endl;
+            }
+            std::cout << "Result cache: " << (cache_.stats().capacity >> 20) << " MB" << std::endl;
+
+            const char *disk_path = std::getenv("FRACTAL_DISK_CACHE");
+            if (disk_path && *disk_path)
+            {
+                disk_.reset(new DiskCache(disk_path, static_cast<size_t>(std::max(1, env_int("FRACTAL_DISK_CACHE_MB", 1024))) << 20));
+                if (disk_->enabled())
+                    std::cout << "Disk cache: " << disk_path << ", " << disk_->stats().entries << " frame(s)" << std::endl;
+                else
+                    disk_.reset();
+            }
+
+            const char *ring_name = std::getenv("FRACTAL_SHM_NAME");
+            if (ring_name && *ring_name)
+            {
+                ring_.reset(new SharedFrameRing(ring_name, static_cast<size_t>(std::max(1, env_int("FRACTAL_SHM_MB", 48))) << 20));
+                if (ring_->enabled())
+                    std::cout << "Shared frame ring: " << ring_name << ", " << std::max(1, env_int("FRACTAL_SHM_MB", 48)) << " MB" << std::endl;
+                else
+                    ring_.reset();
+            }
+        }
+    std::atomic<bool> timeout_state{false};
 
-    Status CalculateJulia(ServerContext *context, const JuliaRequest *request, JuliaResponse *response) override
+    ServerUnaryReactor *CalculateJulia(CallbackServerContext *context, const JuliaRequest *request, JuliaResponse *response) override
     {
+        UnaryCall *reactor = new UnaryCall();
         auto md = context->client_metadata();
-        auto it_shutdown = md.find("x-shutdown-worker");
         auto it = md.find("x-simulate-unavailability");
-        if (it != md.end() && timeout_state)
+        if (it != md.end() && timeout_state.exchange(false))
         {
             std::cerr << "[SERVER] Simulating UNAVAILABLE" << std::endl;
-            timeout_state = false;
-            return Status(grpc::StatusCode::UNAVAILABLE, "simulated-unavailable");
+            reactor->Finish(Status(grpc::StatusCode::UNAVAILABLE, "simulated-unavailable"));
+            return reactor;
         }
         timeout_state = true;
-        sf::Image image;
-        image.create(request->width(), request->height());
-
-        double calc_time_sec = calculator.calculate_polynomial(
-            image,
-            std::complex<double>(request->c_real(), request->c_imag()),
-            request->max_iterations(),
-            request->poly_degree(),
-            request->x_min(), request->x_max(),
-            request->y_min(), request->y_max());
-
-        const sf::Uint8 *pixelPtr = image.getPixelsPtr();
-        size_t totalBytes = request->width() * request->height() * 4;
-        response->set_rgba_data(pixelPtr, totalBytes);
-        response->set_calculation_time_ms(calc_time_sec * 1000.0);
-        response->set_server_id(server_id_);
 
-        return Status::OK;
+        PendingRender pending{context, request, response,
+                              [this, reactor, request, response](const Status &status)
+                              {
+                                  if (status.ok())
+                                      share(*request, response);
+                                  reactor->Finish(status);
+                              },
+                              render_key(*request), reactor->cancel};
+        if (lead(pending))
+            enqueue(pending);
+        return reactor;
     }
 
-       Status Shutdown(ServerContext *,
-                    const fractal::ShutdownRequest *,
-                    fractal::ShutdownResponse *response) override
+    grpc::ServerWriteReactor<fractal::JuliaBatchResponse> *CalculateJuliaBatch(CallbackServerContext *context,
+                                                                              const fractal::JuliaBatchRequest *request) override
+    {
+        return new BatchStream(this, context, request);
+    }
+
+    grpc::ServerWriteReactor<fractal::FrameChunk> *CalculateJuliaStream(CallbackServerContext *context,
+                                                                       const JuliaRequest *request) override
+    {
+        return new ChunkStream(this, context, request);
+    }
+
+    grpc::ServerWriteReactor<fractal::TrajectoryFrame> *RenderTrajectory(CallbackServerContext *context,
+                                                                        const fractal::TrajectoryRequest *request) override
+    {
+        return new TrajectoryStream(this, context, request);
+    }
+
+    grpc::ServerBidiReactor<fractal::SessionUpdate, fractal::SessionFrame> *InteractiveSession(CallbackServerContext *context) override
+    {
+        return new SessionStream(this, context);
+    }
+
+    ServerUnaryReactor *Shutdown(CallbackServerContext *context,
+                                 const fractal::ShutdownRequest *,
+                                 fractal::ShutdownResponse *response) override
     {
         response->set_message("Server shutting down");
+        // health-checking clients stop routing here before the port goes away
+        g_server->GetHealthCheckService()->SetServingStatus(false);
 
         std::thread([]
                     {
@@ -71,16 +275,1255 @@ class FractalServiceImpl final : public fractal::FractalService::Service
             g_server->Shutdown(); })
             .detach();
 
+        ServerUnaryReactor *reactor = context->DefaultReactor();
+        reactor->Finish(Status::OK);
+        return reactor;
+    }
+
+    ServerUnaryReactor *GetServerStats(CallbackServerContext *context,
+                                       const fractal::ServerStatsRequest *,
+                                       fractal::ServerStatsResponse *response) override
+    {
+        ResultCache::Stats stats = cache_.stats();
+        response->set_server_id(server_id_);
+        response->set_cache_hits(stats.hits);
+        response->set_cache_misses(stats.misses);
+        response->set_cache_entries(stats.entries);
+        response->set_cache_bytes(stats.bytes);
+        response->set_cache_capacity(stats.capacity);
+        response->set_cache_evictions(stats.evictions);
+        response->set_coalesced_requests(coalesced_.load());
+        if (disk_)
+        {
+            DiskCache::Stats disk = disk_->stats();
+            response->set_disk_hits(disk.hits);
+            response->set_disk_entries(disk.entries);
+            response->set_disk_bytes(disk.bytes);
+            response->set_disk_capacity(disk.capacity);
+        }
+
+        ServerUnaryReactor *reactor = context->DefaultReactor();
+        reactor->Finish(Status::OK);
+        return reactor;
+    }
+
+    // Pushes one frame through the whole render path (compute pool, palette, both codecs) and fills the
+    // buffer pools with pre-faulted frames of that size, so the first real request finds everything warm.
+    void warm_up(unsigned int width, unsigned int height)
+    {
+        size_t n_pixels = static_cast<size_t>(width) * height;
+        std::vector<sf::Uint16> counts = count_pool_.take();
+        std::vector<sf::Uint8> pixels = pixel_pool_.take();
+        pixels.resize(n_pixels * 4);
+        std::vector<FrameJob> frames{{nullptr, std::complex<double>(-0.8, 0.156), 100, 2, -2.0, 2.0, -2.0, 2.0, 0,
+                                      &counts, pixels.data(), width, height}};
+        // not timed: a cold first render (page faults, empty pools) would make the deadline checks pessimistic
+        calculator.calculate_batch(frames);
+        std::string encoded;
+        FrameCodec::encode(pixels.data(), width, height, 4, FrameCodec::Qoi, encoded, calculator.getScheduler());
+        FrameCodec::encode(pixels.data(), width, height, 4, FrameCodec::Deflate, encoded, calculator.getScheduler());
+        count_pool_.give(std::move(counts));
+        pixel_pool_.give(std::move(pixels));
+
+        // enough for every render worker to start on a frame this size without allocating
+        size_t buffers = static_cast<size_t>(executor_.getWorkers());
+        count_pool_.prefill(buffers, n_pixels);
+        pixel_pool_.prefill(buffers, n_pixels * 4);
+    }
+
+    private:
+    // Streams the frames of one CalculateJuliaBatch call in the order they finish. Its frames go through
+    // the caches, single-flight and render executor like any CalculateJulia, in chunks of FRACTAL_BATCH_MAX
+    // so the chunks render side by side on the compute pool. One write is in flight at a time; the stream
+    // ends once every frame is done, with the first error if any frame failed.
+    class BatchStream : public grpc::ServerWriteReactor<fractal::JuliaBatchResponse>
+    {
+        FractalServiceImpl *service_;
+        const fractal::JuliaBatchRequest *request_;
+        std::vector<fractal::JuliaBatchResponse> slots_;
+        std::shared_ptr<std::atomic<bool>> cancel_ = std::make_shared<std::atomic<bool>>(false);
+        std::deque<size_t> ready_;
+        size_t remaining_;
+        bool writing_ = false;
+        bool broken_ = false;
+        Status status_;
+        std::mutex mutex_;
+
+    public:
+        BatchStream(FractalServiceImpl *service, CallbackServerContext *context, const fractal::JuliaBatchRequest *request)
+            : service_(service), request_(request), slots_(request->requests_size()), remaining_(slots_.size() + 1)
+        {
+            // remaining_ counts the constructor itself too, so the stream cannot finish before it returns
+            std::vector<PendingRender> renders;
+            for (size_t i = 0; i < slots_.size(); ++i)
+            {
+                const JuliaRequest &frame = request->requests(static_cast<int>(i));
+                slots_[i].set_index(static_cast<int>(i));
+                PendingRender pending{context, &frame, slots_[i].mutable_response(),
+                                      [this, i](const Status &status)
+                                      { completed(i, status); },
+                                      service_->render_key(frame), cancel_};
+                if (service->lead(pending))
+                    renders.push_back(pending);
+            }
+            for (size_t begin = 0; begin < renders.size(); begin += service->batch_max_)
+            {
+                size_t end = std::min(renders.size(), begin + service->batch_max_);
+                service->dispatch(std::vector<PendingRender>(renders.begin() + begin, renders.begin() + end));
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            --remaining_;
+            pump();
+        }
+
+        void OnWriteDone(bool ok) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            writing_ = false;
+            if (!ok)
+                broken_ = true;
+            pump();
+        }
+
+        // frames still rendering stop; they complete as cancelled
+        void OnCancel() override { cancel_->store(true); }
+
+        void OnDone() override { delete this; }
+
+    private:
+        void completed(size_t index, const Status &status)
+        {
+            if (status.ok())
+                service_->share(request_->requests(static_cast<int>(index)), slots_[index].mutable_response());
+            std::lock_guard<std::mutex> lock(mutex_);
+            --remaining_;
+            if (status.ok())
+                ready_.push_back(index);
+            else if (status_.ok())
+                status_ = status;
+            pump();
+        }
+
+        // with mutex_ held: writes the next finished frame, or ends the stream once nothing is left to send
+        void pump()
+        {
+            if (writing_)
+                return;
+            if (!ready_.empty() && !broken_)
+            {
+                writing_ = true;
+                StartWrite(&slots_[ready_.front()]);
+                ready_.pop_front();
+                return;
+            }
+            if (remaining_ == 0)
+                Finish(status_);
+        }
+    };
+
+    // Streams one frame as bands of about FRACTAL_CHUNK_KB of rows, so its size is not bound by the message
+    // limit. Each band is a windowed render on the executor (recomputing the rows either side that the
+    // blur needs) and is encoded on its own. The next band renders while the previous one is written, so
+    // the stream holds two bands at most however big the frame is. These frames skip the caches.
+    class ChunkStream : public grpc::ServerWriteReactor<fractal::FrameChunk>
+    {
+        FractalServiceImpl *service_;
+        const JuliaRequest *request_;
+        fractal::PixelFormat format_;
+        fractal::FrameEncoding encoding_;
+        unsigned int width_, height_;
+        unsigned int band_rows_;
+        unsigned int next_row_ = 0; // first row no render has been started for
+        std::unique_ptr<fractal::FrameChunk> ready_;
+        std::unique_ptr<fractal::FrameChunk> sending_;
+        bool rendering_ = false;
+        bool writing_ = false;
+        bool stopping_ = false;
+        bool finished_ = false;
+        std::atomic<bool> cancel_{false};
+        Status status_;
+        std::mutex mutex_;
+
+    public:
+        ChunkStream(FractalServiceImpl *service, CallbackServerContext *, const JuliaRequest *request)
+            : service_(service), request_(request), format_(pixel_format(*request)),
+              encoding_(fractal::FrameEncoding_IsValid(request->encoding()) ? request->encoding() : fractal::RAW),
+              width_(static_cast<unsigned int>(std::max(0, request->width()))),
+              height_(static_cast<unsigned int>(std::max(0, request->height())))
+        {
+            size_t row_bytes = static_cast<size_t>(std::max(1u, width_)) *
+                               (format_ == fractal::RGBA8 ? 4 : format_ == fractal::ITER16 ? 2 : 1);
+            // whole post-process bands where they fit, so band edges line up with the colouring tiles
+            size_t rows = std::max<size_t>(1, service->chunk_bytes_ / row_bytes);
+            size_t align = ParallelCalculator::post_process_band_rows();
+            if (rows > align)
+                rows -= rows % align;
+            band_rows_ = static_cast<unsigned int>(std::min<size_t>(rows, std::max(1u, height_)));
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            status_ = check_frame(*request);
+            if (!status_.ok())
+                stopping_ = true;
+            step();
+        }
+
+        void OnWriteDone(bool ok) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            writing_ = false;
+            sending_.reset();
+            if (!ok)
+                stopping_ = true;
+            step();
+        }
+
+        void OnCancel() override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            cancel_ = true;
+            step();
+        }
+
+        void OnDone() override { delete this; }
+
+    private:
+        // with mutex_ held: writes the rendered band, starts the next one once there is room for it, and
+        // ends the stream when everything is sent
+        void step()
+        {
+            if (finished_)
+                return;
+            if (!writing_ && ready_ && !stopping_)
+            {
+                sending_ = std::move(ready_);
+                writing_ = true;
+                StartWrite(sending_.get());
+            }
+            if (!rendering_ && !ready_ && !stopping_ && next_row_ < height_)
+            {
+                unsigned int first_row = next_row_;
+                next_row_ += std::min(band_rows_, height_ - first_row);
+                rendering_ = true;
+                if (!service_->executor_.submit([this, first_row]
+                                                { render(first_row); }))
+                {
+                    rendering_ = false;
+                    stopping_ = true;
+                    status_ = Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "render queue full");
+                }
+            }
+            if (!writing_ && !rendering_ && (stopping_ || (next_row_ >= height_ && !ready_)))
+            {
+                finished_ = true;
+                Finish(status_);
+            }
+        }
+
+        // render worker: one band, straight into its message when it is raw RGBA
+        void render(unsigned int first_row)
+        {
+            const JuliaRequest &request = *request_;
+            unsigned int rows = std::min(band_rows_, height_ - first_row);
+            std::unique_ptr<fractal::FrameChunk> chunk(new fractal::FrameChunk());
+            std::vector<sf::Uint16> counts = service_->count_pool_.take();
+            std::vector<sf::Uint8> staging;
+            sf::Uint8 *pixels = nullptr;
+            if (format_ == fractal::RGBA8 && encoding_ == fractal::RAW)
+            {
+                std::string *out = chunk->mutable_data();
+                out->resize(static_cast<size_t>(width_) * rows * 4);
+                pixels = reinterpret_cast<sf::Uint8 *>(&(*out)[0]);
+            }
+            else if (format_ == fractal::RGBA8)
+            {
+                staging = service_->pixel_pool_.take();
+                staging.resize(static_cast<size_t>(width_) * rows * 4);
+                pixels = staging.data();
+            }
+            std::vector<FrameJob> frames{{nullptr,
+                                          std::complex<double>(request.c_real(), request.c_imag()),
+                                          request.max_iterations(),
+                                          request.poly_degree(),
+                                          request.x_min(), request.x_max(),
+                                          request.y_min(), request.y_max(),
+                                          request.theme(),
+                                          &counts,
+                                          pixels,
+                                          width_, height_,
+                                          &cancel_,
+                                          first_row, rows}};
+            double calc_time_sec = service_->calculator.calculate_batch(frames);
+            if (!cancel_)
+            {
+                FrameCodec::Encoding used = service_->pack(format_, encoding_, counts, staging, width_, rows,
+                                                           chunk->mutable_data());
+                chunk->set_first_row(static_cast<int>(first_row));
+                chunk->set_rows(static_cast<int>(rows));
+                chunk->set_encoding(static_cast<fractal::FrameEncoding>(used));
+                chunk->set_format(format_);
+                chunk->set_calculation_time_ms(calc_time_sec * 1000.0);
+                chunk->set_server_id(service_->server_id_);
+            }
+            service_->count_pool_.give(std::move(counts));
+            service_->pixel_pool_.give(std::move(staging));
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            rendering_ = false;
+            if (!cancel_)
+                ready_ = std::move(chunk);
+            step();
+        }
+    };
+
+    // Walks c along a trajectory and streams the frames in order. Up to lookahead frames past the one
+    // being written are rendering at any time, each through the normal pipeline (so they batch with other
+    // traffic and spread over the compute pool); the window moves on as each frame is written. A failed
+    // frame ends the stream with its status after the frames before it.
+    class TrajectoryStream : public grpc::ServerWriteReactor<fractal::TrajectoryFrame>
+    {
+        struct Slot
+        {
+            JuliaRequest request;
+            fractal::TrajectoryFrame message;
+            bool done = false;
+            bool encoded = false; // delta or keyframe encoding done, only used with keyframes
+            Status status;
+        };
+
+        FractalServiceImpl *service_;
+        CallbackServerContext *context_;
+        JuliaRequest frame_;
+        std::complex<double> c_, step_;
+        int frame_count_;
+        int lookahead_;
+        int keyframe_interval_;
+        fractal::FrameEncoding encoding_;
+        std::string previous_;   // raw pixels of the last frame encoded, for the next delta
+        int since_keyframe_ = 0;
+        int next_submit_;
+        int next_write_;
+        int next_encode_;
+        bool encoder_running_ = false; // one thread at a time encodes frames, in order
+        bool starting_ = false;        // renders are being started on a gRPC thread
+        std::deque<std::unique_ptr<Slot>> slots_; // frames next_write_ .. next_submit_ - 1
+        std::shared_ptr<std::atomic<bool>> cancel_ = std::make_shared<std::atomic<bool>>(false);
+        int in_flight_ = 1;                        // the constructor holds one until it is done
+        bool writing_ = false;
+        bool stopping_ = false;
+        bool finished_ = false;
+        Status status_;
+        std::mutex mutex_;
+
+    public:
+        TrajectoryStream(FractalServiceImpl *service, CallbackServerContext *context, const fractal::TrajectoryRequest *request)
+            : service_(service), context_(context), frame_(request->frame()),
+              c_(request->frame().c_real(), request->frame().c_imag()),
+              step_(request->step_real(), request->step_imag()),
+              frame_count_(std::max(0, request->frame_count())),
+              lookahead_(request->lookahead() > 0 ? std::min(request->lookahead(), 64) : 8),
+              keyframe_interval_(std::max(0, request->keyframe_interval())),
+              encoding_(fractal::FrameEncoding_IsValid(frame_.encoding()) ? frame_.encoding() : fractal::RAW),
+              next_submit_(0), next_write_(0), next_encode_(0)
+        {
+            // frames are rendered raw and encoded in order once rendered, each delta against the one before
+            if (keyframe_interval_ > 0)
+                frame_.set_encoding(fractal::RAW);
+
+            for (int i = 0; i < std::min(std::max(0, request->first_frame()), frame_count_); ++i)
+                step();
+            next_submit_ = next_write_ = next_encode_ = std::min(std::max(0, request->first_frame()), frame_count_);
+            status_ = check_frame(frame_);
+            stopping_ = !status_.ok();
+            advance();
+            std::lock_guard<std::mutex> lock(mutex_);
+            --in_flight_;
+            pump();
+        }
+
+        void OnWriteDone(bool ok) override
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                writing_ = false;
+                if (ok)
+                {
+                    slots_.pop_front();
+                    ++next_write_;
+                }
+                else
+                    stopping_ = true;
+            }
+            advance();
+        }
+
+        void OnCancel() override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            cancel_->store(true);
+            pump();
+        }
+
+        void OnDone() override { delete this; }
+
+    private:
+        // one step along the path, reflecting like generate_trajectory.py
+        void step()
+        {
+            c_ += step_;
+            if (std::abs(c_.real()) > 2.0)
+                step_.real(-step_.real());
+            if (std::abs(c_.imag()) > 2.0)
+                step_.imag(-step_.imag());
+        }
+
+        // fills the lookahead window; the renders are started outside the lock because a cache hit
+        // completes synchronously, and their encoding is then left to a render worker
+        void advance()
+        {
+            std::vector<PendingRender> start;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                starting_ = true;
+                while (!stopping_ && next_submit_ < frame_count_ && next_submit_ < next_write_ + lookahead_)
+                {
+                    slots_.emplace_back(new Slot());
+                    Slot &slot = *slots_.back();
+                    slot.request = frame_;
+                    slot.request.set_c_real(c_.real());
+                    slot.request.set_c_imag(c_.imag());
+                    slot.message.set_frame_index(next_submit_);
+                    slot.message.set_c_real(c_.real());
+                    slot.message.set_c_imag(c_.imag());
+                    Slot *target = &slot;
+                    start.push_back({context_, &slot.request, slot.message.mutable_response(),
+                                     [this, target](const Status &status)
+                                     { completed(target, status); },
+                                     service_->render_key(slot.request), cancel_});
+                    ++next_submit_;
+                    ++in_flight_;
+                    step();
+                }
+            }
+            for (PendingRender &pending : start)
+                if (service_->lead(pending))
+                    service_->enqueue(pending);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                starting_ = false;
+                if (!encodable())
+                {
+                    pump();
+                    return;
+                }
+                ++in_flight_; // the encoding job below
+            }
+            if (!service_->executor_.submit([this]
+                                            { encode_ready(); release(); }))
+            {
+                encode_ready();
+                release();
+            }
+        }
+
+        void completed(Slot *slot, const Status &status)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                slot->done = true;
+                slot->status = status;
+                if (!status.ok())
+                {
+                    stopping_ = true;
+                    if (status_.ok())
+                        status_ = status;
+                }
+            }
+            // still counted in in_flight_, so the stream cannot finish under the encoding
+            encode_ready();
+            release();
+        }
+
+        // with mutex_ held: the next frame to encode is rendered and nobody is encoding
+        bool encodable()
+        {
+            size_t index = static_cast<size_t>(next_encode_ - next_write_);
+            return keyframe_interval_ > 0 && !encoder_running_ && !starting_ && !stopping_ &&
+                   index < slots_.size() && slots_[index]->done && slots_[index]->status.ok();
+        }
+
+        // Encodes rendered frames in order, on the render worker that completed the next one; callers are
+        // counted in in_flight_. A frame being encoded is not written meanwhile, as writes wait for it.
+        void encode_ready()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!encodable())
+                return;
+            encoder_running_ = true;
+            while (!stopping_ && static_cast<size_t>(next_encode_ - next_write_) < slots_.size())
+            {
+                Slot *slot = slots_[next_encode_ - next_write_].get();
+                if (!slot->done || !slot->status.ok())
+                    break;
+                lock.unlock();
+                encode(slot->message.mutable_response());
+                lock.lock();
+                slot->encoded = true;
+                ++next_encode_;
+                pump();
+            }
+            encoder_running_ = false;
+        }
+
+        // drops the caller's in_flight_ count once it is done rendering or encoding
+        void release()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --in_flight_;
+            pump();
+        }
+
+        // with mutex_ held: writes the next frame in order once it is rendered and encoded, or ends the stream
+        void pump()
+        {
+            if (writing_ || finished_)
+                return;
+            if (!slots_.empty() && slots_.front()->done && slots_.front()->status.ok() &&
+                (keyframe_interval_ == 0 || slots_.front()->encoded) && !context_->IsCancelled())
+            {
+                writing_ = true;
+                StartWrite(&slots_.front()->message);
+                return;
+            }
+            if (in_flight_ == 0 && (stopping_ || next_write_ == frame_count_))
+            {
+                finished_ = true;
+                Finish(status_);
+            }
+        }
+
+        // by the encoding thread alone: encodes the next raw frame, whole if a keyframe is due and as a
+        // delta against the frame before it otherwise
+        void encode(JuliaResponse *response)
+        {
+            unsigned int bytes_per_pixel = response->format() == fractal::ITER16 ? 2 : response->format() == fractal::PALETTE8 ? 1 : 4;
+            std::string raw;
+            raw.swap(*response->mutable_rgba_data());
+            const sf::Uint8 *pixels = reinterpret_cast<const sf::Uint8 *>(raw.data());
+            FrameCodec::Encoding used;
+            if (since_keyframe_ == 0 || previous_.size() != raw.size())
+            {
+                used = FrameCodec::encode(pixels, frame_.width(), frame_.height(), bytes_per_pixel,
+                                          static_cast<FrameCodec::Encoding>(encoding_), *response->mutable_rgba_data(),
+                                          service_->calculator.getScheduler());
+                since_keyframe_ = 0;
+            }
+            else
+            {
+                used = FrameCodec::encodeDelta(pixels, reinterpret_cast<const sf::Uint8 *>(previous_.data()),
+                                               frame_.width(), frame_.height(), bytes_per_pixel,
+                                               static_cast<FrameCodec::Encoding>(encoding_), *response->mutable_rgba_data(),
+                                               service_->calculator.getScheduler());
+                response->set_delta(true);
+            }
+            response->set_encoding(static_cast<fractal::FrameEncoding>(used));
+            since_keyframe_ = (since_keyframe_ + 1) % keyframe_interval_;
+            previous_.swap(raw);
+        }
+    };
+
+    // Keeps one render in flight for the newest update of an InteractiveSession. An update arriving while
+    // it renders replaces any update still waiting and cancels that render, which stops at its next row;
+    // one that completes anyway is still sent, as it is the freshest frame there is. A finished frame
+    // waiting behind the write in progress is likewise replaced by a newer one. The stream ends once the
+    // client has closed its side and its last update is sent, or with the first failed render.
+    class SessionStream : public grpc::ServerBidiReactor<fractal::SessionUpdate, fractal::SessionFrame>
+    {
+        struct Render
+        {
+            JuliaRequest request;
+            fractal::SessionFrame message;
+            std::shared_ptr<std::atomic<bool>> cancel = std::make_shared<std::atomic<bool>>(false);
+        };
+
+        FractalServiceImpl *service_;
+        CallbackServerContext *context_;
+        fractal::SessionUpdate incoming_;
+        std::unique_ptr<fractal::SessionUpdate> waiting_; // newest update, not rendering yet
+        std::unique_ptr<Render> rendering_;
+        std::unique_ptr<Render> ready_;   // rendered, waiting for the write in progress
+        std::unique_ptr<Render> sending_;
+        uint32_t dropped_ = 0;            // updates superseded since the last frame sent
+        bool reading_ = true;
+        bool writing_ = false;
+        bool stopping_ = false;
+        bool finished_ = false;
+        Status status_;
+        std::mutex mutex_;
+
+    public:
+        SessionStream(FractalServiceImpl *service, CallbackServerContext *context)
+            : service_(service), context_(context)
+        {
+            StartRead(&incoming_);
+        }
+
+        void OnReadDone(bool ok) override
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (ok && !stopping_ && !finished_)
+                {
+                    if (waiting_)
+                        ++dropped_;
+                    waiting_.reset(new fractal::SessionUpdate());
+                    waiting_->Swap(&incoming_);
+                    if (rendering_)
+                        rendering_->cancel->store(true);
+                    StartRead(&incoming_);
+                }
+                else
+                    reading_ = false;
+            }
+            advance();
+        }
+
+        void OnWriteDone(bool ok) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            writing_ = false;
+            sending_.reset();
+            if (!ok)
+                stopping_ = true;
+            pump();
+        }
+
+        void OnCancel() override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            if (rendering_)
+                rendering_->cancel->store(true);
+            pump();
+        }
+
+        void OnDone() override { delete this; }
+
+    private:
+        // starts the waiting update once the previous render is out of the way; outside the lock,
+        // because a cache hit completes synchronously
+        void advance()
+        {
+            PendingRender start;
+            uint64_t sequence = 0;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (rendering_ || !waiting_ || stopping_)
+                {
+                    pump();
+                    return;
+                }
+                rendering_.reset(new Render());
+                rendering_->request.Swap(waiting_->mutable_frame());
+                rendering_->message.set_sequence(waiting_->sequence());
+                waiting_.reset();
+                start = {context_, &rendering_->request, rendering_->message.mutable_response(),
+                         [this](const Status &status)
+                         { completed(status); },
+                         service_->render_key(rendering_->request), rendering_->cancel};
+                sequence = rendering_->message.sequence();
+            }
+            if (!service_->lead(start))
+                return;
+            const JuliaRequest &request = *start.request;
+            if (request.progressive() && request.width() > 8 && request.height() > 8 &&
+                service_->executor_.submit([this, start, sequence]
+                                           { preview(start, sequence); }))
+                return;
+            service_->enqueue(start);
+        }
+
+        // render worker: the coarse passes of a progressive update, each sent as a preview as soon as it
+        // is done; the full render then only computes the pixels they left out
+        void preview(PendingRender pending, uint64_t sequence)
+        {
+            const JuliaRequest &request = *pending.request;
+            pending.counts = std::make_shared<std::vector<sf::Uint16>>(service_->count_pool_.take());
+            for (unsigned int step : {8u, 4u, 2u})
+            {
+                std::vector<FrameJob> frames{{nullptr,
+                                              std::complex<double>(request.c_real(), request.c_imag()),
+                                              request.max_iterations(),
+                                              request.poly_degree(),
+                                              request.x_min(), request.x_max(),
+                                              request.y_min(), request.y_max(),
+                                              request.theme(),
+                                              pending.counts.get(),
+                                              nullptr,
+                                              static_cast<unsigned int>(request.width()),
+                                              static_cast<unsigned int>(request.height()),
+                                              pending.cancel.get()}};
+                frames[0].step = step;
+                frames[0].done_step = pending.done_step;
+                double calc_time_sec = service_->calculator.calculate_batch(frames);
+                if (pending.cancel->load())
+                    break;
+                pending.done_step = step;
+
+                std::unique_ptr<Render> frame(new Render());
+                frame->message.set_sequence(sequence);
+                service_->pack_preview(request, *pending.counts, step, frame->message.mutable_response());
+                frame->message.mutable_response()->set_calculation_time_ms(calc_time_sec * 1000.0);
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!stopping_ && !pending.cancel->load())
+                {
+                    if (ready_ && ready_->message.response().scale() == 0)
+                        ++dropped_;
+                    ready_ = std::move(frame);
+                    pump();
+                }
+            }
+            // a cancelled render still goes through, so whoever waits on it is handed on
+            service_->enqueue(pending);
+        }
+
+        void completed(const Status &status)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                std::unique_ptr<Render> render = std::move(rendering_);
+                if (status.ok())
+                {
+                    if (ready_ && ready_->message.response().scale() == 0)
+                        ++dropped_;
+                    ready_ = std::move(render);
+                }
+                else if (render->cancel->load() && !stopping_)
+                    ++dropped_;
+                else
+                {
+                    stopping_ = true;
+                    if (status_.ok())
+                        status_ = status;
+                }
+            }
+            advance();
+        }
+
+        // with mutex_ held: sends the newest finished frame, or ends the stream once nothing is left
+        void pump()
+        {
+            if (writing_ || finished_)
+                return;
+            if (ready_ && !stopping_)
+            {
+                sending_ = std::move(ready_);
+                sending_->message.set_dropped_updates(dropped_);
+                dropped_ = 0;
+                service_->share(sending_->request, sending_->message.mutable_response());
+                writing_ = true;
+                StartWrite(&sending_->message);
+                return;
+            }
+            if (!rendering_ && (stopping_ || (!reading_ && !waiting_)))
+            {
+                finished_ = true;
+                Finish(status_);
+            }
+        }
+    };
+
+    // hands a leader to the batcher, or straight to the executor when batching is off
+    void enqueue(const PendingRender &pending)
+    {
+        PendingRender leader = pending;
+        if (!settle_unrenderable(leader))
+            return;
+        if (batcher_)
+            batcher_->add(leader);
+        else
+            dispatch({leader});
+    }
+
+    // Answers pending from the caches, or parks it behind an identical render already in flight; true
+    // when neither applied and pending is now the leader that has to be rendered. A frame that cannot be
+    // rendered at all is refused here, before it reaches the executor.
+    bool lead(PendingRender &pending)
+    {
+        Status invalid = check_frame(*pending.request);
+        if (!invalid.ok())
+        {
+            pending.done(invalid);
+            return false;
+        }
+        std::shared_ptr<const ResultCache::Frame> frame;
+        if (cache_.enabled())
+            frame = cache_.get(pending.key);
+        if (!frame && disk_)
+        {
+            frame = disk_->get(pending.key);
+            if (frame && cache_.enabled())
+                cache_.put(pending.key, frame);
+        }
+        if (frame)
+        {
+            pending.response->set_rgba_data(frame->pixels);
+            pending.response->set_encoding(static_cast<fractal::FrameEncoding>(frame->encoding));
+            pending.response->set_format(static_cast<fractal::PixelFormat>(frame->format));
+            pending.response->set_calculation_time_ms(0.0);
+            pending.response->set_server_id(server_id_);
+            pending.done(Status::OK);
+            return false;
+        }
+
+        // a retry of a frame that is still rendering rides along with the first attempt
+        std::lock_guard<std::mutex> lock(inflight_mutex_);
+        auto it = inflight_.find(pending.key);
+        if (it != inflight_.end())
+        {
+            it->second.push_back(pending);
+            ++coalesced_;
+            return false;
+        }
+        inflight_.emplace(pending.key, std::vector<PendingRender>());
+        return true;
+    }
+
+    // the pixel format a request gets: PALETTE8 only while every count fits a byte, RGBA8 for unknown values
+    // INVALID_ARGUMENT for sizes no buffer can be made for: not positive, or more than MAX_FRAME_PIXELS
+    static Status check_frame(const JuliaRequest &request)
+    {
+        if (request.width() <= 0 || request.height() <= 0)
+            return Status(grpc::StatusCode::INVALID_ARGUMENT, "width and height must be positive");
+        if (static_cast<uint64_t>(request.width()) * static_cast<uint64_t>(request.height()) > MAX_FRAME_PIXELS)
+            return Status(grpc::StatusCode::INVALID_ARGUMENT, "frame has more than " + std::to_string(MAX_FRAME_PIXELS) + " pixels");
         return Status::OK;
     }
+
+    static fractal::PixelFormat pixel_format(const JuliaRequest &request)
+    {
+        fractal::PixelFormat format = request.format();
+        if (!fractal::PixelFormat_IsValid(format))
+            return fractal::RGBA8;
+        if (format == fractal::PALETTE8 && request.max_iterations() > 255)
+            return fractal::ITER16;
+        return format;
+    }
+
+    // everything the response bytes depend on; theme and blur only matter when the server does the
+    // colouring, and blur is part of it because the disk cache outlives a restart with FRACTAL_BLUR changed
+    std::string render_key(const JuliaRequest &request) const
+    {
+        fractal::PixelFormat format = pixel_format(request);
+        std::string key;
+        ResultCache::appendKey(key, request.c_real());
+        ResultCache::appendKey(key, request.c_imag());
+        ResultCache::appendKey(key, request.x_min());
+        ResultCache::appendKey(key, request.x_max());
+        ResultCache::appendKey(key, request.y_min());
+        ResultCache::appendKey(key, request.y_max());
+        ResultCache::appendKey(key, static_cast<int64_t>(request.width()));
+        ResultCache::appendKey(key, static_cast<int64_t>(request.height()));
+        ResultCache::appendKey(key, static_cast<int64_t>(request.max_iterations()));
+        ResultCache::appendKey(key, static_cast<int64_t>(request.poly_degree()));
+        ResultCache::appendKey(key, static_cast<int64_t>(format));
+        ResultCache::appendKey(key, static_cast<int64_t>(format == fractal::RGBA8 ? request.theme() : 0));
+        ResultCache::appendKey(key, static_cast<int64_t>(format == fractal::RGBA8 && calculator.getBlur()));
+        ResultCache::appendKey(key, static_cast<int64_t>(request.encoding()));
+        return key;
+    }
+
+    void dispatch(std::vector<PendingRender> &&batch)
+    {
+        auto job = std::make_shared<std::vector<PendingRender>>(std::move(batch));
+        if (!executor_.submit([this, job]
+                              { render_batch(*job); }))
+        {
+            for (PendingRender &p : *job)
+                finish(p, Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "render queue full"));
+        }
+    }
+
+    void render_batch(std::vector<PendingRender> &batch)
+    {
+        std::vector<PendingRender> live;
+        for (PendingRender &p : batch)
+        {
+            // the client may have given up, or run too short of time, while the request sat in the
+            // queue; anyone waiting on it takes its place
+            PendingRender leader = p;
+            if (settle_unrenderable(leader))
+                live.push_back(leader);
+        }
+        if (live.empty())
+            return;
+
+        std::vector<std::vector<sf::Uint16>> counts(live.size());
+        std::vector<std::vector<sf::Uint8>> staging(live.size());
+        std::vector<fractal::PixelFormat> formats(live.size());
+        std::vector<fractal::FrameEncoding> encodings(live.size());
+        std::vector<FrameJob> frames;
+        frames.reserve(live.size());
+        for (size_t i = 0; i < live.size(); ++i)
+        {
+            const JuliaRequest &request = *live[i].request;
+            formats[i] = pixel_format(request);
+            // the client's preferred encoding, raw for values this server does not know
+            encodings[i] = fractal::FrameEncoding_IsValid(request.encoding()) ? request.encoding() : fractal::RAW;
+            size_t n_pixels = static_cast<size_t>(request.width()) * request.height();
+
+            // raw RGBA is coloured straight into the response bytes, everything else into a pooled buffer
+            sf::Uint8 *pixels = nullptr;
+            if (formats[i] == fractal::RGBA8 && encodings[i] == fractal::RAW)
+            {
+                std::string *out = live[i].response->mutable_rgba_data();
+                out->resize(n_pixels * 4);
+                pixels = reinterpret_cast<sf::Uint8 *>(&(*out)[0]);
+            }
+            else if (formats[i] == fractal::RGBA8)
+            {
+                staging[i] = pixel_pool_.take();
+                staging[i].resize(n_pixels * 4);
+                pixels = staging[i].data();
+            }
+            counts[i] = live[i].counts ? std::move(*live[i].counts) : count_pool_.take();
+            frames.push_back({nullptr,
+                              std::complex<double>(request.c_real(), request.c_imag()),
+                              request.max_iterations(),
+                              request.poly_degree(),
+                              request.x_min(), request.x_max(),
+                              request.y_min(), request.y_max(),
+                              request.theme(),
+                              &counts[i],
+                              pixels,
+                              static_cast<unsigned int>(request.width()),
+                              static_cast<unsigned int>(request.height()),
+                              live[i].cancel.get()});
+            frames.back().done_step = live[i].done_step;
+            frames.back().deadline = steady_deadline(*live[i].context);
+        }
+
+        double calc_time_sec = calculator.calculate_batch(frames);
+
+        bool complete = true;
+        double cost = 0;
+        for (size_t i = 0; i < live.size(); ++i)
+        {
+            complete = complete && !frames[i].stopped();
+            cost += live[i].cost;
+        }
+        if (complete)
+            learn_cost(calc_time_sec, cost);
+
+        std::vector<std::pair<std::string, std::shared_ptr<const ResultCache::Frame>>> persist;
+
+        for (size_t i = 0; i < live.size(); ++i)
+        {
+            if (frames[i].stopped())
+            {
+                // stopped part-way, so there is nothing to send or cache; whoever waits on it renders anew
+                count_pool_.give(std::move(counts[i]));
+                pixel_pool_.give(std::move(staging[i]));
+                PendingRender next;
+                if (promote_follower(live[i].key, next))
+                    enqueue(next);
+                live[i].done(stop_status(live[i]));
+                continue;
+            }
+            FrameCodec::Encoding used = pack(formats[i], encodings[i], counts[i], staging[i], live[i].request->width(),
+                                             live[i].request->height(), live[i].response->mutable_rgba_data());
+            count_pool_.give(std::move(counts[i]));
+            pixel_pool_.give(std::move(staging[i]));
+            live[i].response->set_encoding(static_cast<fractal::FrameEncoding>(used));
+            live[i].response->set_format(formats[i]);
+            // the frames of a batch render side by side, so each reports its estimated share of the batch time
+            double share = cost > 0 ? live[i].cost / cost : 1.0 / live.size();
+            live[i].response->set_calculation_time_ms(calc_time_sec * share * 1000.0);
+            live[i].response->set_server_id(server_id_);
+            if (cache_.enabled() || disk_)
+            {
+                auto frame = std::make_shared<const ResultCache::Frame>(
+                    ResultCache::Frame{live[i].response->rgba_data(), used, formats[i]});
+                if (cache_.enabled())
+                    cache_.put(live[i].key, frame);
+                if (disk_)
+                    persist.emplace_back(live[i].key, frame);
+            }
+            finish(live[i], Status::OK);
+        }
+        // written once every caller has its reply, so no response waits on the disk
+        for (auto &entry : persist)
+            disk_->put(entry.first, *entry.second);
+    }
+
+    // Puts a rendered frame (or band of rows) into out in the given format and encoding and returns the
+    // encoding used. Raw RGBA8 is already there; the rest is packed from counts or the coloured staging
+    // buffer (PALETTE8 takes a pooled one for its bytes).
+    FrameCodec::Encoding pack(fractal::PixelFormat format, fractal::FrameEncoding encoding,
+                              const std::vector<sf::Uint16> &counts, std::vector<sf::Uint8> &staging,
+                              unsigned int width, unsigned int height, std::string *out)
+    {
+        if (format == fractal::RGBA8 && encoding == fractal::RAW)
+            return FrameCodec::Raw;
+        if (format == fractal::PALETTE8 && encoding == fractal::RAW)
+        {
+            out->resize(counts.size());
+            std::copy(counts.begin(), counts.end(), reinterpret_cast<sf::Uint8 *>(&(*out)[0]));
+            return FrameCodec::Raw;
+        }
+        // compact formats ship the counts themselves, the client colours them
+        const sf::Uint8 *pixels = staging.data();
+        unsigned int bytes_per_pixel = 4;
+        if (format == fractal::ITER16)
+        {
+            pixels = reinterpret_cast<const sf::Uint8 *>(counts.data());
+            bytes_per_pixel = 2;
+        }
+        else if (format == fractal::PALETTE8)
+        {
+            staging = pixel_pool_.take();
+            staging.assign(counts.begin(), counts.end());
+            pixels = staging.data();
+            bytes_per_pixel = 1;
+        }
+        return FrameCodec::encode(pixels, width, height, bytes_per_pixel,
+                                  static_cast<FrameCodec::Encoding>(encoding), *out, calculator.getScheduler());
+    }
+
+    // A progressive preview: the samples on the grid of step, at 1/step of the size in the request's format
+    // and encoding. RGBA8 previews are coloured without the blur.
+    void pack_preview(const JuliaRequest &request, const std::vector<sf::Uint16> &counts, unsigned int step,
+                      JuliaResponse *response)
+    {
+        unsigned int width = request.width(), height = request.height();
+        unsigned int preview_width = (width + step - 1) / step, preview_height = (height + step - 1) / step;
+        fractal::PixelFormat format = pixel_format(request);
+        fractal::FrameEncoding encoding = fractal::FrameEncoding_IsValid(request.encoding()) ? request.encoding() : fractal::RAW;
+
+        std::vector<sf::Uint16> samples = count_pool_.take();
+        samples.resize(static_cast<size_t>(preview_width) * preview_height);
+        for (unsigned int y = 0; y < preview_height; ++y)
+            for (unsigned int x = 0; x < preview_width; ++x)
+                samples[static_cast<size_t>(y) * preview_width + x] = counts[static_cast<size_t>(y * step) * width + x * step];
+
+        std::string *out = response->mutable_rgba_data();
+        std::vector<sf::Uint8> staging;
+        if (format == fractal::RGBA8)
+        {
+            std::vector<sf::Uint32> palette = calculator.buildPackedPalette(
+                std::min(request.max_iterations(), 65535), request.theme() > 0 ? request.theme() : calculator.getTheme());
+            sf::Uint8 *rgba;
+            if (encoding == fractal::RAW)
+            {
+                out->resize(samples.size() * 4);
+                rgba = reinterpret_cast<sf::Uint8 *>(&(*out)[0]);
+            }
+            else
+            {
+                staging = pixel_pool_.take();
+                staging.resize(samples.size() * 4);
+                rgba = staging.data();
+            }
+            for (size_t i = 0; i < samples.size(); ++i)
+                std::memcpy(rgba + i * 4, &palette[samples[i]], 4);
+        }
+        FrameCodec::Encoding used = pack(format, encoding, samples, staging, preview_width, preview_height, out);
+        count_pool_.give(std::move(samples));
+        pixel_pool_.give(std::move(staging));
+
+        response->set_encoding(static_cast<fractal::FrameEncoding>(used));
+        response->set_format(format);
+        response->set_scale(static_cast<int>(step));
+        response->set_server_id(server_id_);
+    }
+
+    // the caller has gone away, or its frame was superseded before the render started
+    static bool abandoned(const PendingRender &pending)
+    {
+        return pending.context->IsCancelled() || (pending.cancel && pending.cancel->load());
+    }
+
+    // why a render was given up on: its deadline ran out, or its caller cancelled it
+    static Status stop_status(const PendingRender &pending)
+    {
+        if (pending.context->deadline() <= std::chrono::system_clock::now())
+            return Status(grpc::StatusCode::DEADLINE_EXCEEDED, "deadline passed before the frame was rendered");
+        return Status::CANCELLED;
+    }
+
+    static std::chrono::steady_clock::time_point steady_deadline(const CallbackServerContext &context)
+    {
+        auto deadline = context.deadline();
+        if (deadline == std::chrono::system_clock::time_point::max())
+            return std::chrono::steady_clock::time_point::max();
+        return std::chrono::steady_clock::now() + (deadline - std::chrono::system_clock::now());
+    }
+
+    // fills in pending.cost from a coarse sample of the frame
+    void estimate(PendingRender &pending)
+    {
+        if (pending.cost > 0)
+            return;
+        const JuliaRequest &request = *pending.request;
+        FrameJob frame{nullptr, std::complex<double>(request.c_real(), request.c_imag()),
+                       request.max_iterations(), request.poly_degree(),
+                       request.x_min(), request.x_max(), request.y_min(), request.y_max()};
+        frame.width = static_cast<unsigned int>(std::max(0, request.width()));
+        frame.height = static_cast<unsigned int>(std::max(0, request.height()));
+        pending.cost = calculator.estimate_iterations(frame);
+        // the previews already did that share of the pixels
+        if (pending.done_step > 1)
+            pending.cost *= 1.0 - 1.0 / (static_cast<double>(pending.done_step) * pending.done_step);
+    }
+
+    // the render would not finish before the call's deadline at the rate renders have been going
+    bool hopeless(PendingRender &pending)
+    {
+        estimate(pending);
+        auto deadline = pending.context->deadline();
+        double seconds_per_iteration = seconds_per_iteration_.load();
+        if (deadline == std::chrono::system_clock::time_point::max() || seconds_per_iteration <= 0)
+            return false;
+        double left = std::chrono::duration<double>(deadline - std::chrono::system_clock::now()).count();
+        return pending.cost * seconds_per_iteration > left;
+    }
+
+    // folds a finished render's time into the rate, weighted towards recent renders so it follows the load
+    void learn_cost(double seconds, double cost)
+    {
+        if (cost <= 0 || seconds <= 0)
+            return;
+        double sample = seconds / cost;
+        double current = seconds_per_iteration_.load();
+        // batches finish concurrently; retry rather than overwrite a rate another one just folded in
+        double next;
+        do
+            next = current > 0 ? 0.8 * current + 0.2 * sample : sample;
+        while (!seconds_per_iteration_.compare_exchange_weak(current, next));
+    }
+
+    // Settles a leader that is not worth rendering: its caller cancelled (CANCELLED), its deadline passed or
+    // its estimated render time exceeds what is left of the deadline (DEADLINE_EXCEEDED). The render passes to the next follower
+    // in line, which is checked the same way; false when there is none left to render.
+    bool settle_unrenderable(PendingRender &leader)
+    {
+        for (;;)
+        {
+            Status status;
+            if (abandoned(leader))
+                status = stop_status(leader);
+            else if (hopeless(leader))
+                status = Status(grpc::StatusCode::DEADLINE_EXCEEDED, "frame cannot be rendered before the deadline");
+            else
+                return true;
+            PendingRender next;
+            bool promoted = promote_follower(leader.key, next);
+            leader.done(status);
+            if (!promoted)
+                return false;
+            leader = next;
+        }
+    }
+
+    // leaves the pixels of a finished frame in the shared frame ring when the client asked for that and the
+    // frame fits, so only where they are goes over the wire
+    void share(const JuliaRequest &request, JuliaResponse *response)
+    {
+        uint64_t position;
+        const std::string &pixels = response->rgba_data();
+        if (!ring_ || !request.shared_memory() || !ring_->put(pixels.data(), pixels.size(), position))
+            return;
+        fractal::SharedFrame *shared = response->mutable_shared();
+        shared->set_name(ring_->getName());
+        shared->set_instance(ring_->getInstance());
+        shared->set_position(position);
+        shared->set_size(pixels.size());
+        response->clear_rgba_data();
+    }
+
+    // completes a leader and everything that queued up behind it; followers get a copy of its response
+    void finish(PendingRender &leader, const Status &status)
+    {
+        std::vector<PendingRender> followers;
+        {
+            std::lock_guard<std::mutex> lock(inflight_mutex_);
+            auto it = inflight_.find(leader.key);
+            if (it != inflight_.end())
+            {
+                followers.swap(it->second);
+                inflight_.erase(it);
+            }
+        }
+        // the leader's response may be freed as soon as it is finished, so copy it out first
+        for (PendingRender &f : followers)
+        {
+            if (status.ok())
+                f.response->CopyFrom(*leader.response);
+            f.done(status);
+        }
+        leader.done(status);
+    }
+
+    // hands the render for key to its oldest follower when the leader was cancelled
+    bool promote_follower(const std::string &key, PendingRender &next)
+    {
+        std::lock_guard<std::mutex> lock(inflight_mutex_);
+        auto it = inflight_.find(key);
+        if (it == inflight_.end())
+            return false;
+        if (it->second.empty())
+        {
+            inflight_.erase(it);
+            return false;
+        }
+        next = it->second.front();
+        it->second.erase(it->second.begin());
+        return true;
+    }
 };
 
-int main()
+// --health-check: asks the local server's standard health service whether it is SERVING and exits 0 if so.
+// Used as the container healthcheck, so the image needs no separate probe binary.
+static int health_check(const std::string &address)
 {
-    std::cout<<"delaying .....\n";
-    sleep(5);
-    std::cout<<"server starting\n";
+    grpc::GenericStub stub(grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+    // an empty HealthCheckRequest asks about the whole server; HealthCheckResponse{status: SERVING} is 08 01
+    grpc::Slice empty;
+    grpc::ByteBuffer request(&empty, 1), reply;
+    std::promise<Status> done;
+    stub.UnaryCall(&context, "/grpc.health.v1.Health/Check", grpc::StubOptions(), &request, &reply,
+                   [&done](Status status)
+                   { done.set_value(status); });
+    Status status = done.get_future().get();
+    std::vector<grpc::Slice> slices;
+    std::string body;
+    if (status.ok() && reply.Dump(&slices).ok())
+        for (const grpc::Slice &slice : slices)
+            body.append(reinterpret_cast<const char *>(slice.begin()), slice.size());
+    if (body != std::string("\x08\x01", 2))
+    {
+        std::cerr << "not serving" << (status.ok() ? std::string() : ": " + status.error_message()) << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--health-check")
+        return health_check("127.0.0.1:50051");
+
+    // must happen before any thread exists so that every later thread inherits the narrowed mask
+    const char *partition = std::getenv("FRACTAL_CPU_PARTITION");
+    if (partition && *partition)
+        CpuBudget::applyPartition(partition);
+
+    auto started = std::chrono::steady_clock::now();
     grpc::reflection::InitProtoReflectionServerBuilderPlugin();
+    grpc::EnableDefaultHealthCheckService(true);
 
     std::string server_address("0.0.0.0:50051");
     
@@ -88,14 +1531,37 @@ int main()
     gethostname(hostname, sizeof(hostname));
     std::string server_id = std::string(hostname) + ":50051";
     
-    FractalServiceImpl service(server_id);
+    std::cout << "CPU budget: " << CpuBudget::threads() << " (affinity " << CpuBudget::affinityCpus()
+              << ", cgroup quota " << CpuBudget::quotaCpus() << ")" << std::endl;
+    TileScheduler scheduler(env_int("FRACTAL_COMPUTE_THREADS", CpuBudget::threads()), env_int("FRACTAL_PIN_THREADS", 1) != 0);
+    std::cout << "Compute pool: " << scheduler.getWorkers() << " thread(s)" << (scheduler.isPinned() ? ", pinned" : "") << std::endl;
+
+    FractalServiceImpl service(server_id, &scheduler);
+    // warm before the port opens, so the health service never reports a cold replica as SERVING
+    if (env_int("FRACTAL_WARMUP", 1) != 0)
+        service.warm_up(800, 600);
     ServerBuilder builder;
 
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    // clients on this host can skip TCP loopback with a unix:PATH target
+    const char *unix_socket = std::getenv("FRACTAL_UNIX_SOCKET");
+    if (unix_socket && *unix_socket)
+    {
+        server_address += ", unix:" + std::string(unix_socket);
+        builder.AddListeningPort("unix:" + std::string(unix_socket), grpc::InsecureServerCredentials());
+    }
     builder.RegisterService(&service);
 
     g_server = builder.BuildAndStart();
-    std::cout << "Fractal Server running on " << server_address << " (id: " << server_id << ")" << std::endl;
+    if (!g_server)
+    {
+        std::cerr << "Failed to start the server on " << server_address << std::endl;
+        return 1;
+    }
+    g_server->GetHealthCheckService()->SetServingStatus(fractal::FractalService::service_full_name(), true);
+    std::cout << "Fractal Server running on " << server_address << " (id: " << server_id << ") after "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count()
+              << " ms" << std::endl;
 
     g_server->Wait(); 
     std::cout << "Server stopped" << std::endl;